@@ -1135,6 +1135,18 @@ extern "C" {
  *  Allows specification of the Wayland app_id.
  */
 #define GLFW_WAYLAND_APP_ID         0x00026001
+/*! @brief Wayland specific
+ *  [window hint](@ref GLFW_WAYLAND_ALLOW_TEARING_hint).
+ */
+#define GLFW_WAYLAND_ALLOW_TEARING  0x00026002
+/*! @brief OSMesa specific
+ *  [window hint](@ref GLFW_OSMESA_PIXEL_FORMAT_hint).
+ */
+#define GLFW_OSMESA_PIXEL_FORMAT    0x00027001
+/*! @brief OSMesa specific
+ *  [window hint](@ref GLFW_OSMESA_DOUBLEBUFFER_hint).
+ */
+#define GLFW_OSMESA_DOUBLEBUFFER    0x00027002
 /*! @} */
 
 #define GLFW_NO_API                          0
@@ -1180,6 +1192,15 @@ extern "C" {
 #define GLFW_WAYLAND_PREFER_LIBDECOR    0x00038001
 #define GLFW_WAYLAND_DISABLE_LIBDECOR   0x00038002
 
+#define GLFW_TIMER_SOURCE_DEFAULT       0x00039001
+#define GLFW_TIMER_SOURCE_MONOTONIC_RAW 0x00039002
+#define GLFW_TIMER_SOURCE_TSC           0x00039003
+
+#define GLFW_OSMESA_RGBA8           0x0003A001
+#define GLFW_OSMESA_BGRA8           0x0003A002
+#define GLFW_OSMESA_RGBA16          0x0003A003
+#define GLFW_OSMESA_RGBA32F         0x0003A004
+
 #define GLFW_ANY_POSITION           0x80000000
 
 /*! @defgroup shapes Standard cursor shapes
@@ -1308,6 +1329,11 @@ extern "C" {
  *  Platform selection [init hint](@ref GLFW_PLATFORM).
  */
 #define GLFW_PLATFORM               0x00050003
+/*! @brief Timer source init hint.
+ *
+ *  Timer source [init hint](@ref GLFW_TIMER_SOURCE_hint).
+ */
+#define GLFW_TIMER_SOURCE           0x00050004
 /*! @brief macOS specific init hint.
  *
  *  macOS specific [init hint](@ref GLFW_COCOA_CHDIR_RESOURCES_hint).
@@ -1407,6 +1433,18 @@ typedef struct GLFWmonitor GLFWmonitor;
  */
 typedef struct GLFWwindow GLFWwindow;
 
+/*! @brief Opaque context pool object.
+ *
+ *  Opaque context pool object.
+ *
+ *  @see @ref context_pool
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup context
+ */
+typedef struct GLFWcontextpool GLFWcontextpool;
+
 /*! @brief Opaque cursor object.
  *
  *  Opaque cursor object.
@@ -1973,6 +2011,29 @@ typedef void (* GLFWcharmodsfun)(GLFWwindow* window, unsigned int codepoint, int
  */
 typedef void (* GLFWdropfun)(GLFWwindow* window, int path_count, const char* paths[]);
 
+/*! @brief The function pointer type for clipboard request callbacks.
+ *
+ *  This is the function pointer type for clipboard request callbacks.  A
+ *  clipboard request callback function has the following signature:
+ *  @code
+ *  void function_name(GLFWwindow* window, const char* string)
+ *  @endcode
+ *
+ *  @param[in] window The window that requested the clipboard contents.
+ *  @param[in] string The contents of the clipboard as a UTF-8 encoded string,
+ *  or `NULL` if they could not be retrieved.
+ *
+ *  @pointer_lifetime The string is valid until the callback function returns.
+ *
+ *  @sa @ref clipboard_async
+ *  @sa @ref glfwRequestClipboardString
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWclipboardfun)(GLFWwindow* window, const char* string);
+
 /*! @brief The function pointer type for monitor configuration callbacks.
  *
  *  This is the function pointer type for monitor configuration callbacks.
@@ -2127,6 +2188,45 @@ typedef struct GLFWgamepadstate
     float axes[6];
 } GLFWgamepadstate;
 
+/*! @brief Frame presentation timings.
+ *
+ *  This describes the most recent presentation feedback for a window.  All
+ *  times are in the units of the [raw timer](@ref time) and frames are numbered
+ *  from one in the order they were submitted with @ref glfwSwapBuffers.
+ *
+ *  @sa @ref buffer_swap_timings
+ *  @sa @ref glfwGetFrameTimings
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+typedef struct GLFWframetimings
+{
+    /*! The number of the most recently submitted frame, or zero if no frame
+     *  has been submitted.
+     */
+    uint64_t frame;
+    /*! The time at which the most recently submitted frame was submitted.
+     */
+    uint64_t submitTime;
+    /*! The number of the most recently presented frame, or zero if no frame is
+     *  known to have been presented.
+     */
+    uint64_t presentedFrame;
+    /*! The time at which the most recently presented frame became visible.
+     */
+    uint64_t presentTime;
+    /*! The time of the most recent vertical blanking period known, or zero if
+     *  unknown.
+     */
+    uint64_t vblankTime;
+    /*! The refresh interval of the display presenting the window, or zero if
+     *  unknown or variable.
+     */
+    uint64_t refreshInterval;
+} GLFWframetimings;
+
 /*! @brief Custom heap memory allocator.
  *
  *  This describes a custom heap memory allocator for GLFW.  To set an allocator, pass it
@@ -3228,7 +3328,9 @@ GLFWAPI void glfwWindowHintString(int hint, const char* value);
  *  [GLFW_X11_INSTANCE_NAME](@ref GLFW_X11_INSTANCE_NAME_hint) window hints to
  *  override this.
  *
- *  @thread_safety This function must only be called from the main thread.
+ *  @thread_safety This function must only be called from the main thread,
+ *  except on the Null platform where it may be called from any thread.  See
+ *  @ref thread_safety.
  *
  *  @sa @ref window_creation
  *  @sa @ref glfwDestroyWindow
@@ -3239,6 +3341,63 @@ GLFWAPI void glfwWindowHintString(int hint, const char* value);
  */
 GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height, const char* title, GLFWmonitor* monitor, GLFWwindow* share);
 
+/*! @brief Creates a layer of the specified window.
+ *
+ *  This function creates a window layer and its associated context.  A layer
+ *  is a window object without a frame that is shown on top of the content area
+ *  of its parent window, and above any layers of that window created before
+ *  it.  Each layer has its own framebuffer or Vulkan surface and is presented
+ *  independently of its parent, so for example video and a user interface can
+ *  be updated at different rates.
+ *
+ *  The context of the layer is created according to the current
+ *  [window hints](@ref window_hints), like for @ref glfwCreateWindow.  The
+ *  window related hints are ignored.  Use @ref GLFW_TRANSPARENT_FRAMEBUFFER to
+ *  let the parent window show through a layer.
+ *
+ *  The layer starts at the upper-left corner of the content area of its parent.
+ *  It is moved with @ref glfwSetWindowPos and resized with @ref
+ *  glfwSetWindowSize, both in screen coordinates relative to the content area
+ *  of the parent.  Layers are shown with their parent window and can be hidden
+ *  with @ref glfwHideWindow.  They never receive input; all input goes to the
+ *  parent window.
+ *
+ *  Layers are destroyed with @ref glfwDestroyWindow and are destroyed along
+ *  with their parent window.
+ *
+ *  @param[in] parent The window to create a layer of.  This must be
+ *  a windowed mode window.
+ *  @param[in] width The desired width, in screen coordinates, of the layer.
+ *  This must be greater than zero.
+ *  @param[in] height The desired height, in screen coordinates, of the layer.
+ *  This must be greater than zero.
+ *  @param[in] share The window whose context to share resources with, or `NULL`
+ *  to not share resources.
+ *  @return The handle of the created layer, or `NULL` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_ENUM, @ref GLFW_INVALID_VALUE, @ref GLFW_API_UNAVAILABLE, @ref
+ *  GLFW_VERSION_UNAVAILABLE, @ref GLFW_FORMAT_UNAVAILABLE, @ref
+ *  GLFW_PLATFORM_ERROR and @ref GLFW_FEATURE_UNAVAILABLE (see remarks).
+ *
+ *  @remark __Wayland:__ Layers are desynchronized `wl_subsurface` objects.
+ *  Moving a layer commits the surface of its parent window.
+ *
+ *  @remark __Win32, macOS, X11:__ Window layers are not yet implemented and
+ *  this function will emit @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref window_layers
+ *  @sa @ref glfwDestroyWindow
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI GLFWwindow* glfwCreateWindowLayer(GLFWwindow* parent, int width, int height, GLFWwindow* share);
+
 /*! @brief Destroys the specified window and its context.
  *
  *  This function destroys the specified window and its context.  On calling
@@ -3247,17 +3406,22 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height, const char* title, G
  *  If the context of the specified window is current on the main thread, it is
  *  detached before being destroyed.
  *
+ *  Contexts belonging to a [context pool](@ref context_pool) cannot be
+ *  destroyed individually and are destroyed with their pool.
+ *
  *  @param[in] window The window to destroy.
  *
- *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
- *  GLFW_PLATFORM_ERROR.
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
  *
  *  @note The context of the specified window must not be current on any other
  *  thread when this function is called.
  *
  *  @reentrancy This function must not be called from a callback.
  *
- *  @thread_safety This function must only be called from the main thread.
+ *  @thread_safety This function must only be called from the main thread,
+ *  except on the Null platform where it may be called from any thread.  See
+ *  @ref thread_safety.
  *
  *  @sa @ref window_creation
  *  @sa @ref glfwCreateWindow
@@ -3436,7 +3600,8 @@ GLFWAPI void glfwSetWindowIcon(GLFWwindow* window, int count, const GLFWimage* i
  *
  *  @remark __Wayland:__ Window positions are not currently part of any common
  *  Wayland protocol, so this function cannot be implemented and will emit @ref
- *  GLFW_FEATURE_UNAVAILABLE.
+ *  GLFW_FEATURE_UNAVAILABLE.  The position of a [window layer](@ref
+ *  window_layers) relative to its parent window is supported.
  *
  *  @thread_safety This function must only be called from the main thread.
  *
@@ -3470,7 +3635,8 @@ GLFWAPI void glfwGetWindowPos(GLFWwindow* window, int* xpos, int* ypos);
  *
  *  @remark __Wayland:__ Window positions are not currently part of any common
  *  Wayland protocol, so this function cannot be implemented and will emit @ref
- *  GLFW_FEATURE_UNAVAILABLE.
+ *  GLFW_FEATURE_UNAVAILABLE.  The position of a [window layer](@ref
+ *  window_layers) relative to its parent window is supported.
  *
  *  @thread_safety This function must only be called from the main thread.
  *
@@ -4158,6 +4324,173 @@ GLFWAPI int glfwGetWindowAttrib(GLFWwindow* window, int attrib);
  */
 GLFWAPI void glfwSetWindowAttrib(GLFWwindow* window, int attrib, int value);
 
+/*! @brief Returns a pixel buffer for drawing the contents of the specified
+ *  window on the CPU.
+ *
+ *  This function returns a pointer to memory where the application can draw
+ *  the next frame of the specified window, without any client API.  The
+ *  contents are shown when @ref glfwPresentPixelBuffer is called.
+ *
+ *  Each pixel is a 32-bit value in host byte order, with alpha in the most
+ *  significant byte followed by red, green and blue, i.e. `0xAARRGGBB`.  Color
+ *  components are premultiplied by alpha.  Alpha is ignored unless the window
+ *  has a [transparent framebuffer](@ref window_transparency).  Rows are stored
+ *  top to bottom and the start of each row is `stride` bytes after the previous
+ *  one.
+ *
+ *  The buffer is at least the size of the framebuffer of the window when this
+ *  function is called.  Its contents are undefined and the whole frame should
+ *  be drawn.  This function may block until the window system has finished
+ *  reading a previously presented buffer.
+ *
+ *  The specified window must have been created with the
+ *  [GLFW_CLIENT_API](@ref GLFW_CLIENT_API_hint) hint set to `GLFW_NO_API`.
+ *  Specifying a window with a context will generate a @ref GLFW_INVALID_VALUE
+ *  error.  If the framebuffer of the window is empty, for example because the
+ *  window is minimized on some platforms, this function returns `NULL` and
+ *  generates a @ref GLFW_INVALID_VALUE error.
+ *
+ *  @param[in] window The window to draw.
+ *  @param[out] width Where to store the width, in pixels, of the buffer, or
+ *  `NULL`.
+ *  @param[out] height Where to store the height, in pixels, of the buffer, or
+ *  `NULL`.
+ *  @param[out] stride Where to store the distance, in bytes, between the start
+ *  of consecutive rows, or `NULL`.
+ *  @return The pixels of the buffer, or `NULL` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_PLATFORM_ERROR and @ref
+ *  GLFW_FEATURE_UNAVAILABLE (see remarks).
+ *
+ *  @remark __Win32, macOS:__ Pixel buffers are not yet implemented and this
+ *  function will emit @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @remark __X11:__ The buffer is shared with the X server with the MIT-SHM
+ *  extension when available and otherwise copied when presented.  Windows
+ *  whose visual is not 24-bit RGB will emit @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @remark __Null:__ The buffer is never shown anywhere.
+ *
+ *  @pointer_lifetime The returned buffer is allocated and freed by GLFW.  You
+ *  should not free it yourself.  It is valid until the next call to @ref
+ *  glfwPresentPixelBuffer for the specified window, or until the window is
+ *  resized or destroyed.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref window_pixels
+ *  @sa @ref glfwPresentPixelBuffer
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI unsigned char* glfwGetWindowPixelBuffer(GLFWwindow* window, int* width, int* height, int* stride);
+
+/*! @brief Shows the pixel buffer of the specified window.
+ *
+ *  This function shows the buffer last returned by @ref
+ *  glfwGetWindowPixelBuffer in the specified window.  The next call to that
+ *  function may return a different buffer.
+ *
+ *  Each rectangle is four integers; the x- and y-coordinates of its upper-left
+ *  corner followed by its width and height, in pixels relative to the
+ *  upper-left corner of the buffer.  Only these parts of the window are
+ *  updated, or the whole window if the count is zero.
+ *
+ *  If no pixel buffer has been retrieved for the window, this function does
+ *  nothing.
+ *
+ *  @param[in] window The window to update.
+ *  @param[in] rects The changed rectangles, as `4 * count` integers, or `NULL`
+ *  if the count is zero.
+ *  @param[in] count The number of changed rectangles.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_PLATFORM_ERROR and @ref
+ *  GLFW_FEATURE_UNAVAILABLE (see remarks).
+ *
+ *  @remark __Win32, macOS:__ Pixel buffers are not yet implemented and this
+ *  function will emit @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @remark __Wayland:__ Nothing is presented while the window is hidden.  If
+ *  the window was just shown, this function waits for it to be configured.
+ *  Damage rectangles are only used if the compositor supports version 4 of
+ *  `wl_surface`.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref window_pixels
+ *  @sa @ref glfwGetWindowPixelBuffer
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwPresentPixelBuffer(GLFWwindow* window, const int* rects, int count);
+
+/*! @brief Sets the render scale of the specified window.
+ *
+ *  This function sets the fraction of the framebuffer size of the specified
+ *  window that is rendered.  The framebuffer is then upscaled to fill the
+ *  window when it is shown.  This reduces the number of pixels rendered each
+ *  frame on high-DPI displays without changing the window size, content scale
+ *  or cursor coordinates.
+ *
+ *  The new framebuffer size is reported with the
+ *  [framebuffer size callback](@ref window_fbsize) and by @ref
+ *  glfwGetFramebufferSize.  Vulkan applications should recreate their swapchain
+ *  with that size.  The initial render scale of all windows is one.
+ *
+ *  @param[in] window The window to set the render scale of.
+ *  @param[in] scale The render scale, greater than zero and at most one.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_PLATFORM_ERROR and @ref
+ *  GLFW_FEATURE_UNAVAILABLE (see remarks).
+ *
+ *  @remark __Wayland:__ The framebuffer is upscaled by the compositor with the
+ *  `wp_viewporter` protocol.  If the compositor does not support it, this
+ *  function will emit @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @remark __Win32, macOS, X11:__ Render scaling is not supported and this
+ *  function will emit @ref GLFW_FEATURE_UNAVAILABLE for scales other than one.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref window_render_scale
+ *  @sa @ref glfwGetWindowRenderScale
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwSetWindowRenderScale(GLFWwindow* window, float scale);
+
+/*! @brief Returns the render scale of the specified window.
+ *
+ *  This function returns the render scale of the specified window, as set with
+ *  @ref glfwSetWindowRenderScale.
+ *
+ *  @param[in] window The window to query.
+ *  @return The render scale of the specified window, or one if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref window_render_scale
+ *  @sa @ref glfwSetWindowRenderScale
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI float glfwGetWindowRenderScale(GLFWwindow* window);
+
 /*! @brief Sets the user pointer of the specified window.
  *
  *  This function sets the user-defined pointer of the specified window.  The
@@ -4640,10 +4973,62 @@ GLFWAPI void glfwWaitEvents(void);
  */
 GLFWAPI void glfwWaitEventsTimeout(double timeout);
 
+/*! @brief Waits until events are queued or a deadline is reached and processes
+ *  them.
+ *
+ *  This function puts the calling thread to sleep until at least one event is
+ *  available in the event queue, or until the raw timer reaches the specified
+ *  deadline.  If one or more events are available, it behaves exactly like
+ *  @ref glfwPollEvents, i.e. the events in the queue are processed and the
+ *  function then returns immediately.  Processing events will cause the window
+ *  and input callbacks associated with those events to be called.
+ *
+ *  The deadline is an absolute value of the raw timer, in the same units as
+ *  those returned by @ref glfwGetTimerValue.  Unlike a relative timeout, it does
+ *  not need to be recomputed by the caller and does not accumulate drift when
+ *  the wait is interrupted.  A deadline that has already passed makes this
+ *  function behave like @ref glfwPollEvents.
+ *
+ *  Since not all events are associated with callbacks, this function may return
+ *  without a callback having been called even if you are monitoring all
+ *  callbacks.
+ *
+ *  On some platforms, a window move, resize or menu operation will cause event
+ *  processing to block.  This is due to how event processing is designed on
+ *  those platforms.  You can use the
+ *  [window refresh callback](@ref window_refresh) to redraw the contents of
+ *  your window when necessary during such operations.
+ *
+ *  Event processing is not required to receive joystick input.  Joystick state
+ *  is polled when a joystick input or gamepad input function is called.
+ *
+ *  @param[in] deadline The raw timer value at which to stop waiting.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark __Win32:__ The wait is performed with millisecond granularity and is
+ *  rounded up to the next millisecond.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref events
+ *  @sa @ref glfwWaitEventsTimeout
+ *  @sa @ref glfwGetTimerValue
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwWaitEventsUntil(uint64_t deadline);
+
 /*! @brief Posts an empty event to the event queue.
  *
  *  This function posts an empty event from the current thread to the event
- *  queue, causing @ref glfwWaitEvents or @ref glfwWaitEventsTimeout to return.
+ *  queue, causing @ref glfwWaitEvents, @ref glfwWaitEventsTimeout or @ref
+ *  glfwWaitEventsUntil to return.
  *
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
  *  GLFW_PLATFORM_ERROR.
@@ -5103,6 +5488,10 @@ GLFWAPI GLFWcursor* glfwCreateCursor(const GLFWimage* image, int xhot, int yhot)
  *  GLFW_INVALID_ENUM, @ref GLFW_CURSOR_UNAVAILABLE and @ref
  *  GLFW_PLATFORM_ERROR.
  *
+ *  @remark __Wayland:__ If the compositor supports the `wp_cursor_shape_v1`
+ *  protocol, all standard shapes are available and are drawn by the
+ *  compositor.  The cursor theme is then not loaded.
+ *
  *  @thread_safety This function must only be called from the main thread.
  *
  *  @sa @ref cursor_standard
@@ -5987,6 +6376,52 @@ GLFWAPI void glfwSetClipboardString(GLFWwindow* window, const char* string);
  */
 GLFWAPI const char* glfwGetClipboardString(GLFWwindow* window);
 
+/*! @brief Requests the contents of the clipboard without waiting for them.
+ *
+ *  This function requests the contents of the system clipboard as a UTF-8
+ *  encoded string and returns immediately.  The transfer progresses while
+ *  events are processed and the specified callback is called with the string
+ *  when it has completed.  If the clipboard is empty or if its contents cannot
+ *  be converted, the callback is called with `NULL` and a @ref
+ *  GLFW_FORMAT_UNAVAILABLE error is generated.
+ *
+ *  Each window can have one request in progress.  Requesting the clipboard
+ *  again before the callback has been called replaces the callback of the
+ *  earlier request.  If the window is destroyed before the transfer has
+ *  completed, the callback is not called.
+ *
+ *  @param[in] window The window to deliver the clipboard contents to.
+ *  @param[in] callback The function to call with the clipboard contents.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_FORMAT_UNAVAILABLE, @ref GLFW_OUT_OF_MEMORY and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark If the clipboard contents are already available, for example because
+ *  they were set by this application, the callback is called before this
+ *  function returns.
+ *
+ *  @remark __Win32, macOS:__ The clipboard is read synchronously and the
+ *  callback is always called before this function returns.
+ *
+ *  @remark __X11:__ Requesting the clipboard again also restarts the
+ *  transfer, so that a selection owner that never replies does not block
+ *  later requests.
+ *
+ *  @pointer_lifetime The string passed to the callback is valid until the
+ *  callback function returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref clipboard_async
+ *  @sa @ref glfwGetClipboardString
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwRequestClipboardString(GLFWwindow* window, GLFWclipboardfun callback);
+
 /*! @brief Returns the GLFW time.
  *
  *  This function returns the current GLFW time, in seconds.  Unless the time
@@ -6017,6 +6452,35 @@ GLFWAPI const char* glfwGetClipboardString(GLFWwindow* window);
  */
 GLFWAPI double glfwGetTime(void);
 
+/*! @brief Returns the GLFW time in nanoseconds.
+ *
+ *  This function returns the current GLFW time, in integer nanoseconds.  It
+ *  measures the same time as @ref glfwGetTime, including any time set with
+ *  @ref glfwSetTime, but avoids the conversion to floating-point.  This makes
+ *  it suitable for code that reads the time very often, like profiler markers.
+ *
+ *  When the [timer frequency](@ref glfwGetTimerFrequency) is one gigahertz, as
+ *  is the case with most Unix-like systems, the timer value is returned without
+ *  any conversion.
+ *
+ *  @return The current time, in nanoseconds, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function may be called from any thread.  Reading and
+ *  writing of the internal base time is not atomic, so it needs to be
+ *  externally synchronized with calls to @ref glfwSetTime.
+ *
+ *  @sa @ref time
+ *  @sa @ref glfwGetTime
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup input
+ */
+GLFWAPI uint64_t glfwGetTimeNs(void);
+
 /*! @brief Sets the GLFW time.
  *
  *  This function sets the current GLFW time, in seconds.  The value must be
@@ -6089,6 +6553,182 @@ GLFWAPI uint64_t glfwGetTimerValue(void);
  */
 GLFWAPI uint64_t glfwGetTimerFrequency(void);
 
+/*! @brief Creates a context without a window.
+ *
+ *  This function creates an OpenGL or OpenGL ES context that renders to an
+ *  offscreen surface of the specified size instead of to a window.  No native
+ *  window is created.  The context and the default framebuffer of its surface
+ *  are created according to the current [window hints](@ref window_hints),
+ *  except for [GLFW_TRANSPARENT_FRAMEBUFFER](@ref GLFW_TRANSPARENT_FRAMEBUFFER_hint).
+ *
+ *  The returned handle is a window object with a context but without a window.
+ *  It may be passed to the [context functions](@ref context), to @ref
+ *  glfwGetFramebufferSize, @ref glfwGetWindowAttrib for context attributes,
+ *  @ref glfwSetWindowUserPointer, @ref glfwGetWindowUserPointer and @ref
+ *  glfwDestroyWindow.  It must not be passed to any other window function.
+ *
+ *  Offscreen contexts use pbuffers on GLX and EGL and plain memory buffers on
+ *  OSMesa.  Which context creation API is used is selected by the
+ *  [GLFW_CONTEXT_CREATION_API](@ref GLFW_CONTEXT_CREATION_API_hint) hint, as
+ *  for windows.
+ *
+ *  @param[in] width The desired width, in pixels, of the offscreen surface.
+ *  This must be greater than zero.
+ *  @param[in] height The desired height, in pixels, of the offscreen surface.
+ *  This must be greater than zero.
+ *  @param[in] share The window whose context to share resources with, or
+ *  `NULL` to not share resources.
+ *  @return The handle of the created offscreen context, or `NULL` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_ENUM, @ref GLFW_INVALID_VALUE, @ref GLFW_API_UNAVAILABLE, @ref
+ *  GLFW_VERSION_UNAVAILABLE, @ref GLFW_FORMAT_UNAVAILABLE, @ref
+ *  GLFW_NO_WINDOW_CONTEXT and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The client API must not be `GLFW_NO_API`.  Attempting to create an
+ *  offscreen context without a client API will generate a @ref
+ *  GLFW_NO_WINDOW_CONTEXT error.
+ *
+ *  @remark __Win32, macOS:__ Offscreen contexts require EGL or OSMesa.
+ *  Requesting a native offscreen context will generate a @ref
+ *  GLFW_API_UNAVAILABLE error.
+ *
+ *  @remark __Wayland:__ The native context creation API is EGL.
+ *
+ *  @remark __Null:__ The native context creation API is OSMesa.
+ *
+ *  @thread_safety This function must only be called from the main thread,
+ *  except on the Null platform where it may be called from any thread.  See
+ *  @ref thread_safety.
+ *
+ *  @sa @ref context_offscreen
+ *  @sa @ref glfwDestroyWindow
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup context
+ */
+GLFWAPI GLFWwindow* glfwCreateOffscreenContext(int width, int height, GLFWwindow* share);
+
+/*! @brief Creates a pool of shared offscreen contexts.
+ *
+ *  This function creates the specified number of
+ *  [offscreen contexts](@ref glfwCreateOffscreenContext) that share objects
+ *  with the specified window, or with each other if no window is specified.
+ *  The contexts can then be handed out to worker threads with @ref
+ *  glfwAcquirePooledContext and returned with @ref glfwReleasePooledContext.
+ *
+ *  The contexts are created according to the current
+ *  [window hints](@ref window_hints) and each has a 1x1 offscreen surface, as
+ *  they are intended for loading objects and rendering to framebuffer objects.
+ *
+ *  @param[in] count The number of contexts in the pool.  This must be greater
+ *  than zero.
+ *  @param[in] share The window whose context to share objects with, or `NULL`
+ *  to only share objects between the pooled contexts.
+ *  @return The handle of the created pool, or `NULL` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include those of @ref glfwCreateOffscreenContext.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref context_pool
+ *  @sa @ref glfwDestroyContextPool
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup context
+ */
+GLFWAPI GLFWcontextpool* glfwCreateContextPool(int count, GLFWwindow* share);
+
+/*! @brief Destroys a context pool and its contexts.
+ *
+ *  This function destroys the specified context pool and all of its contexts.
+ *  If the context of the calling thread belongs to the pool, it is detached
+ *  before being destroyed.  Any pool that remains when the library is
+ *  terminated is destroyed by @ref glfwTerminate.
+ *
+ *  @param[in] pool The context pool to destroy.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The contexts of the pool must not be current on any other thread
+ *  when this function is called.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref context_pool
+ *  @sa @ref glfwCreateContextPool
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwDestroyContextPool(GLFWcontextpool* pool);
+
+/*! @brief Acquires a context from a pool and makes it current.
+ *
+ *  This function takes a context that is not in use from the specified pool
+ *  and makes it current on the calling thread.  The context remains reserved
+ *  for the calling thread until it is returned with @ref
+ *  glfwReleasePooledContext.
+ *
+ *  If all contexts of the pool are in use, this function returns `NULL`
+ *  without waiting and without generating an error.  If the context cannot be
+ *  made current, this function returns `NULL` and the previously current
+ *  context of the calling thread is made current again.
+ *
+ *  @param[in] pool The pool to acquire a context from.
+ *  @return The acquired context, or `NULL` if all contexts of the pool are in
+ *  use or an [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref context_pool
+ *  @sa @ref glfwReleasePooledContext
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup context
+ */
+GLFWAPI GLFWwindow* glfwAcquirePooledContext(GLFWcontextpool* pool);
+
+/*! @brief Returns a context to its pool.
+ *
+ *  This function detaches the specified pooled context from the calling thread
+ *  if it is current and returns it to its pool, where it can be acquired again
+ *  by any thread.
+ *
+ *  @param[in] context The pooled context to release.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark This function must be called on the thread that acquired the
+ *  context, as a context must be detached from its old thread before it is
+ *  made current on another.  Releasing a context that was not acquired by the
+ *  calling thread will generate a @ref GLFW_INVALID_VALUE error.
+ *
+ *  @thread_safety This function may be called from any thread that acquired
+ *  the specified context.
+ *
+ *  @sa @ref context_pool
+ *  @sa @ref glfwAcquirePooledContext
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwReleasePooledContext(GLFWwindow* context);
+
 /*! @brief Makes the context of the specified window current for the calling
  *  thread.
  *
@@ -6185,6 +6825,7 @@ GLFWAPI GLFWwindow* glfwGetCurrentContext(void);
  *
  *  @sa @ref buffer_swap
  *  @sa @ref glfwSwapInterval
+ *  @sa @ref glfwSetFrameRateTarget
  *
  *  @since Added in version 1.0.
  *  __GLFW 3:__ Added window handle parameter.
@@ -6193,6 +6834,320 @@ GLFWAPI GLFWwindow* glfwGetCurrentContext(void);
  */
 GLFWAPI void glfwSwapBuffers(GLFWwindow* window);
 
+/*! @brief Swaps the front and back buffers of the specified window and then
+ *  processes events.
+ *
+ *  This function swaps the front and back buffers of the specified window like
+ *  @ref glfwSwapBuffers and then immediately processes all pending events like
+ *  @ref glfwPollEvents.  Because the events are processed as soon as the swap
+ *  returns, any input that arrived while the driver was waiting for a screen
+ *  update is seen by the next frame.
+ *
+ *  Processing events will cause the window and input callbacks associated with
+ *  those events to be called.
+ *
+ *  The specified window must have an OpenGL or OpenGL ES context.  Specifying
+ *  a window without a context will generate a @ref GLFW_NO_WINDOW_CONTEXT
+ *  error.
+ *
+ *  @param[in] window The window whose buffers to swap.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_WINDOW_CONTEXT and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark __Wayland:__ When the swap interval is greater than zero, events
+ *  received while waiting for the compositor to request a new frame are read
+ *  during the wait and processed as soon as the swap returns.
+ *
+ *  @remark __EGL:__ The context of the specified window must be current on the
+ *  calling thread.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref buffer_swap
+ *  @sa @ref glfwSwapBuffers
+ *  @sa @ref glfwPollEvents
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwSwapBuffersAndPoll(GLFWwindow* window);
+
+/*! @brief Swaps the front and back buffers of several windows at once.
+ *
+ *  This function swaps the front and back buffers of the specified windows in
+ *  order, waiting for the swap interval at most once.  All windows but the last
+ *  are swapped immediately and the last one is swapped with its own swap
+ *  interval, so that with vertical synchronization all windows are presented
+ *  in the same vertical blank instead of in one each.
+ *
+ *  The context of each window is made current on the calling thread while its
+ *  buffers are swapped, and the previously current context is made current
+ *  again before this function returns.  If the context of a window cannot be
+ *  made current, a @ref GLFW_PLATFORM_ERROR is generated and the buffers of
+ *  that window are not swapped, but the remaining windows are.  The last window
+ *  whose context could be made current is then the one swapped with its swap
+ *  interval.
+ *
+ *  All specified windows must have an OpenGL or OpenGL ES context.  Specifying
+ *  a window without a context will generate a @ref GLFW_NO_WINDOW_CONTEXT
+ *  error and no buffers are swapped.
+ *
+ *  @param[in] windows The windows whose buffers to swap.
+ *  @param[in] count The number of windows in the array.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_NO_WINDOW_CONTEXT and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The contexts of the specified windows must not be current on any
+ *  other thread.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref buffer_swap_multi
+ *  @sa @ref glfwSwapBuffers
+ *  @sa @ref glfwSwapInterval
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwSwapBuffersMulti(GLFWwindow** windows, int count);
+
+/*! @brief Swaps the front and back buffers of the specified window, hinting
+ *  which parts have changed.
+ *
+ *  This function swaps the front and back buffers of the specified window like
+ *  @ref glfwSwapBuffers, but also tells the window system which parts of the
+ *  frame differ from the previous one.  This lets the compositor avoid copying
+ *  and repainting the parts of the window that did not change.
+ *
+ *  Each rectangle is four integers; the x- and y-coordinates of its lower-left
+ *  corner followed by its width and height, in pixels relative to the
+ *  lower-left corner of the framebuffer.  The damage is only a hint and the
+ *  whole buffer is presented if the context does not support it.  If the count
+ *  is zero, this function behaves like @ref glfwSwapBuffers.
+ *
+ *  The specified window must have an OpenGL or OpenGL ES context.  Specifying
+ *  a window without a context will generate a @ref GLFW_NO_WINDOW_CONTEXT
+ *  error.
+ *
+ *  @param[in] window The window whose buffers to swap.
+ *  @param[in] rects The damaged rectangles, as `4 * count` integers, or `NULL`
+ *  if the count is zero.
+ *  @param[in] count The number of damaged rectangles.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_NO_WINDOW_CONTEXT and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark __EGL:__ Damage is only supported with the
+ *  `EGL_KHR_swap_buffers_with_damage` or `EGL_EXT_swap_buffers_with_damage`
+ *  extensions.  The context of the specified window must be current on the
+ *  calling thread.
+ *
+ *  @remark __GLX, WGL, NSGL, OSMesa:__ The damage is ignored.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref buffer_damage
+ *  @sa @ref glfwSwapBuffers
+ *  @sa @ref glfwGetBufferAge
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwSwapBuffersWithDamage(GLFWwindow* window, const int* rects, int count);
+
+/*! @brief Returns the age of the back buffer of the specified window.
+ *
+ *  This function returns the number of frames ago that the current back buffer
+ *  of the specified window was last presented.  A buffer age of one means it
+ *  holds the previous frame, two means the frame before that and so on.  An
+ *  application can then redraw only the regions that changed in that many
+ *  frames and pass them to @ref glfwSwapBuffersWithDamage.
+ *
+ *  A buffer age of zero means the contents of the back buffer are undefined and
+ *  the whole frame must be redrawn.  This is returned for new or resized
+ *  buffers and when the context does not support querying the buffer age.
+ *
+ *  The specified window must have an OpenGL or OpenGL ES context.  Specifying
+ *  a window without a context will generate a @ref GLFW_NO_WINDOW_CONTEXT
+ *  error.
+ *
+ *  @param[in] window The window whose back buffer to query.
+ *  @return The age of the back buffer, or zero if it is unknown or an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_NO_WINDOW_CONTEXT.
+ *
+ *  @remark The context of the specified window must be current on the calling
+ *  thread.
+ *
+ *  @remark __EGL:__ This requires the `EGL_EXT_buffer_age` extension.
+ *
+ *  @remark __GLX:__ This requires the `GLX_EXT_buffer_age` extension.
+ *
+ *  @remark __WGL, NSGL, OSMesa:__ The buffer age is always zero.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref buffer_damage
+ *  @sa @ref glfwSwapBuffersWithDamage
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI int glfwGetBufferAge(GLFWwindow* window);
+
+/*! @brief Sets the target frame rate of the specified window.
+ *
+ *  This function sets the maximum rate at which @ref glfwSwapBuffers will
+ *  present frames for the specified window.  When a target is set, @ref
+ *  glfwSwapBuffers sleeps until the next frame deadline before swapping the
+ *  buffers.  Deadlines are kept on the [raw timer](@ref time) and advance by one
+ *  frame interval per swap, so the rate does not drift with rendering time.
+ *
+ *  The limiter sleeps until shortly before the deadline and then spins for the
+ *  remaining fraction of a millisecond, for accuracy that does not depend on
+ *  the scheduler tick.  If a frame misses its deadline by more than a whole
+ *  interval, the limiter does not try to catch up.
+ *
+ *  This is independent of the [swap interval](@ref buffer_swap) and is mostly
+ *  useful where vertical synchronization is unavailable, such as with software
+ *  rendering or offscreen contexts.  When buffers are swapped with @ref
+ *  glfwSwapBuffersAndPoll, the limiter instead waits for the next deadline
+ *  after the swap and processes events during the wait.  Otherwise it does not
+ *  process events while it sleeps, in the same way a driver does not while
+ *  waiting for a vertical retrace, so keep processing events after each swap as
+ *  usual.
+ *
+ *  @param[in] window The window whose frame rate to limit.
+ *  @param[in] rate The target frame rate, in frames per second, or zero to
+ *  disable the limiter.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_VALUE.
+ *
+ *  @thread_safety This function may be called from any thread.  Access is not
+ *  synchronized.
+ *
+ *  @sa @ref buffer_swap
+ *  @sa @ref glfwSwapBuffers
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwSetFrameRateTarget(GLFWwindow* window, double rate);
+
+/*! @brief Retrieves the frame presentation timings of the specified window.
+ *
+ *  This function retrieves the most recent frame submission and presentation
+ *  timings of the specified window.  The submission fields are always
+ *  available and are recorded by GLFW each time @ref glfwSwapBuffers is called.
+ *  The presentation fields are reported by the window system or the driver
+ *  when supported, and describe when a frame actually reached the screen.
+ *
+ *  Presentation feedback arrives some time after a frame is submitted, so the
+ *  most recently presented frame will usually be one or more frames behind the
+ *  most recently submitted frame.  Compare the `frame` and `presentedFrame`
+ *  members to find the current presentation latency in frames.
+ *
+ *  The specified window must have an OpenGL or OpenGL ES context.  Specifying
+ *  a window without a context will generate a @ref GLFW_NO_WINDOW_CONTEXT
+ *  error.
+ *
+ *  @param[in] window The window to query.
+ *  @param[out] timings Where to store the timings of the specified window.
+ *  Fields that are unknown are set to zero.
+ *  @return `GLFW_TRUE` if presentation timings are available, or `GLFW_FALSE`
+ *  if only the submission timings are known or an [error](@ref error_handling)
+ *  occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_NO_WINDOW_CONTEXT.
+ *
+ *  @remark __Wayland:__ Presentation timings require the `wp_presentation`
+ *  protocol and a compositor that uses the monotonic clock.
+ *
+ *  @remark __X11:__ Presentation timings require the `GLX_OML_sync_control`
+ *  extension.  The present time is that of the first vertical blanking period
+ *  seen after the swap completed, and may be up to one refresh interval late
+ *  unless this function is called every frame.  With EGL, presentation timings
+ *  require the `EGL_ANDROID_get_frame_timestamps` extension.
+ *
+ *  @remark __Win32, macOS:__ Presentation timings are not yet available.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref buffer_swap_timings
+ *  @sa @ref glfwSwapBuffers
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup window
+ */
+GLFWAPI int glfwGetFrameTimings(GLFWwindow* window, GLFWframetimings* timings);
+
+/*! @brief Reads back the framebuffer of the window without stalling.
+ *
+ *  This function starts reading back the color buffer currently selected for
+ *  reading in the context of the specified window and returns the oldest
+ *  readback that has completed.  Call it once per frame, after rendering and
+ *  before @ref glfwSwapBuffers, to capture every frame.
+ *
+ *  When the context supports OpenGL 3.2 or OpenGL ES 3.0, each readback goes
+ *  into a ring of pixel buffer objects guarded by fences, so the pipeline is
+ *  not stalled.  The pixels of a frame are then returned by the call made two
+ *  frames later and this function returns `NULL` the first two times it is
+ *  called.  Older contexts fall back to a synchronous readback of the current
+ *  frame.  With OSMesa, the color buffer is already in host memory and is
+ *  returned directly without copying.
+ *
+ *  The pixels are 8-bit RGBA, tightly packed, with rows ordered from bottom
+ *  to top like those of `glReadPixels`.
+ *
+ *  The context of the specified window must be current on the calling thread.
+ *
+ *  @param[in] window The window whose framebuffer to read back.
+ *  @param[out] width Where to store the width, in pixels, of the returned
+ *  image, or `NULL`.
+ *  @param[out] height Where to store the height, in pixels, of the returned
+ *  image, or `NULL`.
+ *  @return The pixels of the oldest completed readback, or `NULL` if no
+ *  readback has completed yet or an [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_WINDOW_CONTEXT, @ref GLFW_NO_CURRENT_CONTEXT and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The pixel pack alignment, row length and skip parameters are set
+ *  for tightly packed pixels during the readback and then restored.
+ *
+ *  @pointer_lifetime The returned pixels are allocated and freed by GLFW.  You
+ *  should not free them yourself.  They are valid until the next call to this
+ *  function for the same window or until the window is destroyed.  With
+ *  OSMesa, they are the color buffer itself and change with further
+ *  rendering.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref buffer_readback
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup context
+ */
+GLFWAPI const unsigned char* glfwReadFramebufferAsync(GLFWwindow* window, int* width, int* height);
+
 /*! @brief Sets the swap interval for the current context.
  *
  *  This function sets the swap interval for the current OpenGL or OpenGL ES
@@ -6319,6 +7274,51 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  */
 GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname);
 
+/*! @brief Returns the addresses of the specified functions for the current
+ *  context.
+ *
+ *  This function retrieves the addresses of the specified OpenGL or OpenGL ES
+ *  [core or extension functions](@ref context_glext) for the current context
+ *  in a single call.  Each element of `procs` is set to the address of the
+ *  function named by the corresponding element of `procnames`, or to `NULL`
+ *  if that function was not found.
+ *
+ *  Loading many functions this way is cheaper than calling @ref
+ *  glfwGetProcAddress for each of them, as internal locking is only done once
+ *  for the whole batch.
+ *
+ *  A context must be current on the calling thread.  Calling this function
+ *  without a current context will cause a @ref GLFW_NO_CURRENT_CONTEXT error.
+ *
+ *  This function does not apply to Vulkan.
+ *
+ *  @param[in] procnames An array of ASCII encoded function names.
+ *  @param[out] procs An array to receive the function addresses.
+ *  @param[in] count The number of elements in both arrays.
+ *  @return The number of functions that were found, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_CURRENT_CONTEXT, @ref GLFW_INVALID_VALUE and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The same remarks as for @ref glfwGetProcAddress apply to each
+ *  returned address.
+ *
+ *  @pointer_lifetime The returned function pointers are valid until the
+ *  context is destroyed or the library is terminated.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref context_glext
+ *  @sa @ref glfwGetProcAddress
+ *
+ *  @since Added in version 3.6.
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwGetProcAddresses(const char* const* procnames, GLFWglproc* procs, int count);
+
 /*! @brief Returns whether the Vulkan loader and an ICD have been found.
  *
  *  This function returns whether the Vulkan loader and any minimally functional
@@ -6527,6 +7527,11 @@ GLFWAPI int glfwGetPhysicalDevicePresentationSupport(VkInstance instance, VkPhys
  *  hint.  The name of the selected extension, if any, is included in the array
  *  returned by @ref glfwGetRequiredInstanceExtensions.
  *
+ *  @remark __Wayland:__ If the window has been shown but has not yet been
+ *  configured by the compositor, this function waits for the configuration.
+ *  This is only possible on the main thread and elsewhere the function fails
+ *  with @ref GLFW_PLATFORM_ERROR.
+ *
  *  @thread_safety This function may be called from any thread.  For
  *  synchronization details of Vulkan objects, see the Vulkan specification.
  *
@@ -647,8 +647,14 @@ GLFWAPI int glfwGetEGLConfig(GLFWwindow* window, EGLConfig* config);
  *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
  *  [error](@ref error_handling) occurred.
  *
- *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
- *  GLFW_NO_WINDOW_CONTEXT.
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_WINDOW_CONTEXT and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark If the window was created with the @ref
+ *  GLFW_OSMESA_DOUBLEBUFFER_hint hint, this function returns the front
+ *  buffer, which holds the most recently swapped frame.  It is valid until the
+ *  next call to @ref glfwSwapBuffers for the window and fails with @ref
+ *  GLFW_PLATFORM_ERROR until the buffers have been swapped once.
  *
  *  @thread_safety This function may be called from any thread.  Access is not
  *  synchronized.
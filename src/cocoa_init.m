@@ -489,6 +489,7 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampCocoa,
         .createWindow = _glfwCreateWindowCocoa,
         .destroyWindow = _glfwDestroyWindowCocoa,
+        .createOffscreenContext = _glfwCreateOffscreenContextCocoa,
         .setWindowTitle = _glfwSetWindowTitleCocoa,
         .setWindowIcon = _glfwSetWindowIconCocoa,
         .getWindowPos = _glfwGetWindowPosCocoa,
@@ -520,9 +521,13 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingCocoa,
         .setWindowOpacity = _glfwSetWindowOpacityCocoa,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughCocoa,
+        .getWindowPixelBuffer = _glfwGetWindowPixelBufferCocoa,
+        .presentPixelBuffer = _glfwPresentPixelBufferCocoa,
+        .setWindowRenderScale = _glfwSetWindowRenderScaleCocoa,
+        .requestClipboardString = _glfwRequestClipboardStringCocoa,
         .pollEvents = _glfwPollEventsCocoa,
         .waitEvents = _glfwWaitEventsCocoa,
-        .waitEventsTimeout = _glfwWaitEventsTimeoutCocoa,
+        .waitEventsUntil = _glfwWaitEventsUntilCocoa,
         .postEmptyEvent = _glfwPostEmptyEventCocoa,
         .getEGLPlatform = _glfwGetEGLPlatformCocoa,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayCocoa,
@@ -132,6 +132,7 @@ typedef struct _GLFWlibraryNSGL
 {
     // dlopen handle for OpenGL.framework (for glfwGetProcAddress)
     CFBundleRef     framework;
+    _GLFWproccache  procs;
 } _GLFWlibraryNSGL;
 
 // Cocoa-specific per-window data
@@ -216,6 +217,7 @@ void _glfwTerminateCocoa(void);
 
 GLFWbool _glfwCreateWindowCocoa(_GLFWwindow* window, const _GLFWwndconfig* wndconfig, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwDestroyWindowCocoa(_GLFWwindow* window);
+GLFWbool _glfwCreateOffscreenContextCocoa(_GLFWwindow* window, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwSetWindowTitleCocoa(_GLFWwindow* window, const char* title);
 void _glfwSetWindowIconCocoa(_GLFWwindow* window, int count, const GLFWimage* images);
 void _glfwGetWindowPosCocoa(_GLFWwindow* window, int* xpos, int* ypos);
@@ -247,13 +249,16 @@ void _glfwSetWindowFloatingCocoa(_GLFWwindow* window, GLFWbool enabled);
 float _glfwGetWindowOpacityCocoa(_GLFWwindow* window);
 void _glfwSetWindowOpacityCocoa(_GLFWwindow* window, float opacity);
 void _glfwSetWindowMousePassthroughCocoa(_GLFWwindow* window, GLFWbool enabled);
+unsigned char* _glfwGetWindowPixelBufferCocoa(_GLFWwindow* window, int* width, int* height, int* stride);
+void _glfwPresentPixelBufferCocoa(_GLFWwindow* window, const int* rects, int count);
+GLFWbool _glfwSetWindowRenderScaleCocoa(_GLFWwindow* window, float scale);
 
 void _glfwSetRawMouseMotionCocoa(_GLFWwindow *window, GLFWbool enabled);
 GLFWbool _glfwRawMouseMotionSupportedCocoa(void);
 
 void _glfwPollEventsCocoa(void);
 void _glfwWaitEventsCocoa(void);
-void _glfwWaitEventsTimeoutCocoa(double timeout);
+void _glfwWaitEventsUntilCocoa(uint64_t deadline);
 void _glfwPostEmptyEventCocoa(void);
 
 void _glfwGetCursorPosCocoa(_GLFWwindow* window, double* xpos, double* ypos);
@@ -267,6 +272,7 @@ void _glfwDestroyCursorCocoa(_GLFWcursor* cursor);
 void _glfwSetCursorCocoa(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringCocoa(const char* string);
 const char* _glfwGetClipboardStringCocoa(void);
+void _glfwRequestClipboardStringCocoa(_GLFWwindow* window);
 
 EGLenum _glfwGetEGLPlatformCocoa(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayCocoa(void);
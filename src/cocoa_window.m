@@ -952,6 +952,13 @@ GLFWbool _glfwCreateWindowCocoa(_GLFWwindow* window,
 {
     @autoreleasepool {
 
+    if (wndconfig->parent)
+    {
+        _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                        "Cocoa: Window layers are not yet implemented");
+        return GLFW_FALSE;
+    }
+
     if (!createNativeWindow(window, wndconfig, fbconfig))
         return GLFW_FALSE;
 
@@ -1046,6 +1053,34 @@ void _glfwDestroyWindowCocoa(_GLFWwindow* window)
     } // autoreleasepool
 }
 
+GLFWbool _glfwCreateOffscreenContextCocoa(_GLFWwindow* window,
+                                          const _GLFWctxconfig* ctxconfig,
+                                          const _GLFWfbconfig* fbconfig)
+{
+    if (ctxconfig->source == GLFW_NATIVE_CONTEXT_API)
+    {
+        _glfwInputError(GLFW_API_UNAVAILABLE,
+                        "NSGL: Offscreen contexts are not supported");
+        return GLFW_FALSE;
+    }
+    else if (ctxconfig->source == GLFW_EGL_CONTEXT_API)
+    {
+        if (!_glfwInitEGL())
+            return GLFW_FALSE;
+        if (!_glfwCreateContextEGL(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
+    }
+    else if (ctxconfig->source == GLFW_OSMESA_CONTEXT_API)
+    {
+        if (!_glfwInitOSMesa())
+            return GLFW_FALSE;
+        if (!_glfwCreateContextOSMesa(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
 void _glfwSetWindowTitleCocoa(_GLFWwindow* window, const char* title)
 {
     @autoreleasepool {
@@ -1517,6 +1552,28 @@ void _glfwSetWindowMousePassthroughCocoa(_GLFWwindow* window, GLFWbool enabled)
     }
 }
 
+unsigned char* _glfwGetWindowPixelBufferCocoa(_GLFWwindow* window,
+                                              int* width, int* height,
+                                              int* stride)
+{
+    _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                    "Cocoa: Window pixel buffers are not yet implemented");
+    return NULL;
+}
+
+void _glfwPresentPixelBufferCocoa(_GLFWwindow* window, const int* rects, int count)
+{
+    _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                    "Cocoa: Window pixel buffers are not yet implemented");
+}
+
+GLFWbool _glfwSetWindowRenderScaleCocoa(_GLFWwindow* window, float scale)
+{
+    _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                    "Cocoa: Window render scaling is not supported");
+    return GLFW_FALSE;
+}
+
 float _glfwGetWindowOpacityCocoa(_GLFWwindow* window)
 {
     @autoreleasepool {
@@ -1579,10 +1636,16 @@ void _glfwWaitEventsCocoa(void)
     } // autoreleasepool
 }
 
-void _glfwWaitEventsTimeoutCocoa(double timeout)
+void _glfwWaitEventsUntilCocoa(uint64_t deadline)
 {
     @autoreleasepool {
 
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    double timeout = 0.0;
+
+    if (deadline > now)
+        timeout = (double) (deadline - now) / _glfwPlatformGetTimerFrequency();
+
     NSDate* date = [NSDate dateWithTimeIntervalSinceNow:timeout];
     NSEvent* event = [NSApp nextEventMatchingMask:NSEventMaskAny
                                         untilDate:date
@@ -1909,6 +1972,12 @@ const char* _glfwGetClipboardStringCocoa(void)
     } // autoreleasepool
 }
 
+void _glfwRequestClipboardStringCocoa(_GLFWwindow* window)
+{
+    // The pasteboard is read synchronously on macOS
+    _glfwInputClipboardString(window, _glfwGetClipboardStringCocoa());
+}
+
 EGLenum _glfwGetEGLPlatformCocoa(EGLint** attribs)
 {
     if (_glfw.egl.ANGLE_platform_angle)
@@ -32,6 +32,7 @@
 #include <string.h>
 #include <limits.h>
 #include <stdio.h>
+#include <math.h>
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -340,6 +341,70 @@ const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
     return closest;
 }
 
+// Parses the extensions of the current context into its extension set
+//
+static GLFWbool loadContextExtensions(_GLFWwindow* window)
+{
+    if (window->context.major >= 3)
+    {
+        GLint i, count = 0;
+        size_t length = 0;
+
+        window->context.GetIntegerv(GL_NUM_EXTENSIONS, &count);
+        if (count <= 0)
+            return _glfwParseExtensionSet(&window->context.extensions, "");
+
+        const char** names = _glfw_calloc(count, sizeof(char*));
+        if (!names)
+            return GLFW_FALSE;
+
+        for (i = 0;  i < count;  i++)
+        {
+            names[i] = (const char*) window->context.GetStringi(GL_EXTENSIONS, i);
+            if (!names[i])
+            {
+                _glfw_free(names);
+                return GLFW_FALSE;
+            }
+
+            length += strlen(names[i]) + 1;
+        }
+
+        char* extensions = _glfw_calloc(length + 1, 1);
+        if (!extensions)
+        {
+            _glfw_free(names);
+            return GLFW_FALSE;
+        }
+
+        char* end = extensions;
+
+        for (i = 0;  i < count;  i++)
+        {
+            const size_t size = strlen(names[i]);
+            memcpy(end, names[i], size);
+            end[size] = ' ';
+            end += size + 1;
+        }
+
+        const GLFWbool result =
+            _glfwParseExtensionSet(&window->context.extensions, extensions);
+
+        _glfw_free(extensions);
+        _glfw_free(names);
+        return result;
+    }
+    else
+    {
+        const char* extensions = (const char*)
+            window->context.GetString(GL_EXTENSIONS);
+        if (!extensions)
+            return GLFW_FALSE;
+
+        return _glfwParseExtensionSet(&window->context.extensions, extensions);
+    }
+}
+
 // Retrieves the attributes of the current context
 //
 GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
@@ -477,6 +542,11 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
         }
     }
 
+    // NOTE: If the extensions cannot be parsed here, glfwExtensionSupported
+    //       falls back to searching them on every call
+    if (!loadContextExtensions(window))
+        _glfwFreeExtensionSet(&window->context.extensions);
+
     if (window->context.client == GLFW_OPENGL_API)
     {
         // Read back context flags (OpenGL 3.0 and above)
@@ -613,158 +683,1452 @@ GLFWbool _glfwStringInExtensionString(const char* string, const char* extensions
     return GLFW_TRUE;
 }
 
+// Returns the FNV-1a hash of the specified string
+//
+static uint32_t hashString(const char* name, size_t length)
+{
+    uint32_t hash = 2166136261u;
 
-//////////////////////////////////////////////////////////////////////////
-//////                        GLFW public API                       //////
-//////////////////////////////////////////////////////////////////////////
+    for (size_t i = 0;  i < length;  i++)
+    {
+        hash ^= (unsigned char) name[i];
+        hash *= 16777619u;
+    }
 
-GLFWAPI void glfwMakeContextCurrent(GLFWwindow* handle)
+    return hash;
+}
+
+// Parses a space-separated extension string into a hashed set
+//
+GLFWbool _glfwParseExtensionSet(_GLFWextensionset* set, const char* extensions)
 {
-    _GLFW_REQUIRE_INIT();
+    const size_t length = strlen(extensions);
+    size_t count = 0, size = 16;
 
-    _GLFWwindow* window = (_GLFWwindow*) handle;
-    _GLFWwindow* previous;
+    memset(set, 0, sizeof(_GLFWextensionset));
 
-    previous = _glfwPlatformGetTls(&_glfw.contextSlot);
+    for (size_t i = 0;  i < length;  i++)
+    {
+        if (extensions[i] != ' ' && (i == 0 || extensions[i - 1] == ' '))
+            count++;
+    }
 
-    if (window && window->context.client == GLFW_NO_API)
+    // Keep the table at most half full so that probe sequences stay short
+    while (size < count * 2)
+        size *= 2;
+
+    set->names = _glfw_calloc(length + 1, 1);
+    set->hashes = _glfw_calloc(size, sizeof(uint32_t));
+    set->offsets = _glfw_calloc(size, sizeof(uint32_t));
+    if (!set->names || !set->hashes || !set->offsets)
     {
-        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
-                        "Cannot make current with a window that has no OpenGL or OpenGL ES context");
-        return;
+        _glfwFreeExtensionSet(set);
+        return GLFW_FALSE;
     }
 
-    if (previous)
+    memcpy(set->names, extensions, length);
+    set->mask = (uint32_t) size - 1;
+
+    for (size_t start = 0;  start < length;  )
     {
-        if (!window || window->context.source != previous->context.source)
-            previous->context.makeCurrent(NULL);
+        if (set->names[start] == ' ')
+        {
+            set->names[start++] = '\0';
+            continue;
+        }
+
+        size_t end = start;
+        while (end < length && set->names[end] != ' ')
+            end++;
+
+        set->names[end] = '\0';
+
+        const uint32_t hash = hashString(set->names + start, end - start);
+        uint32_t i = hash & set->mask;
+
+        while (set->offsets[i])
+        {
+            // Some implementations list an extension more than once
+            if (set->hashes[i] == hash &&
+                strcmp(set->names + set->offsets[i] - 1, set->names + start) == 0)
+            {
+                break;
+            }
+
+            i = (i + 1) & set->mask;
+        }
+
+        set->hashes[i] = hash;
+        set->offsets[i] = (uint32_t) start + 1;
+        start = end + 1;
     }
 
-    if (window)
-        window->context.makeCurrent(window);
+    return GLFW_TRUE;
 }
 
-GLFWAPI GLFWwindow* glfwGetCurrentContext(void)
+// Searches a hashed extension set for the specified extension
+//
+GLFWbool _glfwExtensionInSet(const _GLFWextensionset* set, const char* extension)
 {
-    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
-    return _glfwPlatformGetTls(&_glfw.contextSlot);
+    if (!set->offsets)
+        return GLFW_FALSE;
+
+    const uint32_t hash = hashString(extension, strlen(extension));
+
+    for (uint32_t i = hash & set->mask;  set->offsets[i];  i = (i + 1) & set->mask)
+    {
+        if (set->hashes[i] == hash &&
+            strcmp(set->names + set->offsets[i] - 1, extension) == 0)
+        {
+            return GLFW_TRUE;
+        }
+    }
+
+    return GLFW_FALSE;
 }
 
-GLFWAPI void glfwSwapBuffers(GLFWwindow* handle)
+// Frees a hashed extension set
+//
+void _glfwFreeExtensionSet(_GLFWextensionset* set)
 {
-    _GLFW_REQUIRE_INIT();
+    _glfw_free(set->names);
+    _glfw_free(set->hashes);
+    _glfw_free(set->offsets);
+    memset(set, 0, sizeof(_GLFWextensionset));
+}
 
-    _GLFWwindow* window = (_GLFWwindow*) handle;
-    assert(window != NULL);
+// Returns whether the two framebuffer configurations request the same thing
+//
+static GLFWbool isSameFBConfig(const _GLFWfbconfig* a, const _GLFWfbconfig* b)
+{
+    return a->redBits == b->redBits &&
+           a->greenBits == b->greenBits &&
+           a->blueBits == b->blueBits &&
+           a->alphaBits == b->alphaBits &&
+           a->depthBits == b->depthBits &&
+           a->stencilBits == b->stencilBits &&
+           a->accumRedBits == b->accumRedBits &&
+           a->accumGreenBits == b->accumGreenBits &&
+           a->accumBlueBits == b->accumBlueBits &&
+           a->accumAlphaBits == b->accumAlphaBits &&
+           a->auxBuffers == b->auxBuffers &&
+           a->stereo == b->stereo &&
+           a->samples == b->samples &&
+           a->sRGB == b->sRGB &&
+           a->doublebuffer == b->doublebuffer &&
+           a->transparent == b->transparent;
+}
 
-    if (window->context.client == GLFW_NO_API)
+// Retrieves the handle of the configuration previously chosen for the specified
+// framebuffer configuration and native type bits, if there is one
+//
+GLFWbool _glfwFindFBConfigChoice(const _GLFWfbconfigcache* cache,
+                                 const _GLFWfbconfig* desired,
+                                 int types,
+                                 uintptr_t* handle)
+{
+    for (int i = 0;  i < cache->choiceCount;  i++)
     {
-        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
-                        "Cannot swap buffers of a window that has no OpenGL or OpenGL ES context");
-        return;
+        if (cache->choiceTypes[i] == types &&
+            isSameFBConfig(cache->choices + i, desired))
+        {
+            *handle = cache->choices[i].handle;
+            return GLFW_TRUE;
+        }
     }
 
-    window->context.swapBuffers(window);
+    return GLFW_FALSE;
 }
 
-GLFWAPI void glfwSwapInterval(int interval)
+// Records the handle of the configuration chosen for the specified framebuffer
+// configuration and native type bits
+//
+void _glfwAddFBConfigChoice(_GLFWfbconfigcache* cache,
+                            const _GLFWfbconfig* desired,
+                            int types,
+                            uintptr_t handle)
 {
-    _GLFWwindow* window;
+    // NOTE: The choice is simply not remembered if memory runs out
+    _GLFWfbconfig* choices =
+        _glfw_realloc(cache->choices,
+                      (cache->choiceCount + 1) * sizeof(_GLFWfbconfig));
+    if (!choices)
+        return;
 
-    _GLFW_REQUIRE_INIT();
+    cache->choices = choices;
 
-    window = _glfwPlatformGetTls(&_glfw.contextSlot);
-    if (!window)
-    {
-        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
-                        "Cannot set swap interval without a current OpenGL or OpenGL ES context");
+    int* choiceTypes =
+        _glfw_realloc(cache->choiceTypes,
+                      (cache->choiceCount + 1) * sizeof(int));
+    if (!choiceTypes)
         return;
-    }
 
-    window->context.swapInterval(interval);
+    cache->choiceTypes = choiceTypes;
+
+    cache->choices[cache->choiceCount] = *desired;
+    cache->choices[cache->choiceCount].handle = handle;
+    cache->choiceTypes[cache->choiceCount] = types;
+    cache->choiceCount++;
 }
 
-GLFWAPI int glfwExtensionSupported(const char* extension)
+// Frees a framebuffer configuration cache
+//
+void _glfwFreeFBConfigCache(_GLFWfbconfigcache* cache)
 {
-    _GLFWwindow* window;
-    assert(extension != NULL);
+    _glfw_free(cache->configs);
+    _glfw_free(cache->types);
+    _glfw_free(cache->choices);
+    _glfw_free(cache->choiceTypes);
+    memset(cache, 0, sizeof(_GLFWfbconfigcache));
+}
 
-    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+// Releases the framebuffer readback resources of the window
+//
+// The context of the window is made current on the calling thread while the
+// GL objects are deleted, as they would otherwise outlive it in its share group
+//
+void _glfwDestroyReadback(_GLFWwindow* window)
+{
+    _GLFWwindow* current = _glfwPlatformGetTls(&_glfw.contextSlot);
 
-    window = _glfwPlatformGetTls(&_glfw.contextSlot);
-    if (!window)
+    if (window->context.readback.async && window != current)
+        glfwMakeContextCurrent((GLFWwindow*) window);
+
+    if (window->context.readback.async &&
+        window == _glfwPlatformGetTls(&_glfw.contextSlot))
     {
-        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
-                        "Cannot query extension without a current OpenGL or OpenGL ES context");
-        return GLFW_FALSE;
+        GLint previous;
+        window->context.GetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &previous);
+
+        for (int i = 0;  i < _GLFW_READBACK_SLOTS;  i++)
+        {
+            if (i == window->context.readback.mapped)
+            {
+                window->context.readback.BindBuffer(GL_PIXEL_PACK_BUFFER,
+                                                    window->context.readback.slots[i].buffer);
+                window->context.readback.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+
+            if (window->context.readback.slots[i].fence)
+                window->context.readback.DeleteSync(window->context.readback.slots[i].fence);
+
+            if ((GLint) window->context.readback.slots[i].buffer == previous)
+                previous = 0;
+
+            window->context.readback.DeleteBuffers(1, &window->context.readback.slots[i].buffer);
+        }
+
+        window->context.readback.BindBuffer(GL_PIXEL_PACK_BUFFER, previous);
     }
 
-    if (*extension == '\0')
+    if (current != _glfwPlatformGetTls(&_glfw.contextSlot))
+        glfwMakeContextCurrent((GLFWwindow*) current);
+
+    _glfw_free(window->context.readback.pixels);
+    memset(&window->context.readback, 0, sizeof(window->context.readback));
+}
+
+// Frees a function cache and the names it holds
+//
+void _glfwFreeProcCache(_GLFWproccache* cache)
+{
+    for (uint32_t i = 0;  cache->entries && i <= cache->mask;  i++)
+        _glfw_free(cache->entries[i].name);
+
+    _glfw_free(cache->entries);
+    memset(cache, 0, sizeof(_GLFWproccache));
+}
+
+
+// Waits until the specified frame deadline, either sleeping or processing
+// events until shortly before it, and spins for the remainder
+//
+static void waitUntilDeadline(uint64_t deadline, GLFWbool processEvents)
+{
+    // NOTE: The wakeup from any sleep or event wait may be late by up to
+    //       a scheduler tick, so the last fraction of a millisecond is spun
+    const uint64_t margin = _glfwPlatformGetTimerFrequency() / 2000;
+
+    for (;;)
     {
-        _glfwInputError(GLFW_INVALID_VALUE, "Extension name cannot be an empty string");
-        return GLFW_FALSE;
+        const uint64_t now = _glfwPlatformGetTimerValue();
+        if (now + margin >= deadline)
+            break;
+
+        // Event waits return early for every event, so keep waiting
+        if (processEvents)
+            _glfw.platform.waitEventsUntil(deadline - margin);
+        else
+        {
+            _glfwPlatformSleepUntil(deadline - margin);
+            break;
+        }
     }
 
-    if (window->context.major >= 3)
+    while (_glfwPlatformGetTimerValue() < deadline)
+        ;
+}
+
+// Sleeps until the next frame deadline of the window's frame rate limiter and
+// schedules the one after it
+//
+static void waitForFrameDeadline(_GLFWwindow* window)
+{
+    uint64_t now = _glfwPlatformGetTimerValue();
+
+    if (window->frameDeadline > now)
     {
-        int i;
-        GLint count;
+        waitUntilDeadline(window->frameDeadline, GLFW_FALSE);
+        now = window->frameDeadline;
+    }
 
-        // Check if extension is in the modern OpenGL extensions string list
+    // Do not try to catch up on frames that were missed by a whole interval
+    if (now - window->frameDeadline < window->frameInterval)
+        window->frameDeadline += window->frameInterval;
+    else
+        window->frameDeadline = now + window->frameInterval;
+}
 
-        window->context.GetIntegerv(GL_NUM_EXTENSIONS, &count);
+// Returns the cached address of the specified function, or NULL if the
+// function has not been cached
+//
+static GLFWglproc findCachedProc(const _GLFWproccache* cache,
+                                 const char* procname,
+                                 uint32_t hash)
+{
+    if (!cache->entries)
+        return NULL;
 
-        for (i = 0;  i < count;  i++)
+    for (uint32_t i = hash & cache->mask;
+         cache->entries[i].name;
+         i = (i + 1) & cache->mask)
+    {
+        if (cache->entries[i].hash == hash &&
+            strcmp(cache->entries[i].name, procname) == 0)
         {
-            const char* en = (const char*)
-                window->context.GetStringi(GL_EXTENSIONS, i);
-            if (!en)
-            {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "Extension string retrieval is broken");
-                return GLFW_FALSE;
-            }
-
-            if (strcmp(en, extension) == 0)
-                return GLFW_TRUE;
+            return cache->entries[i].proc;
         }
     }
-    else
+
+    return NULL;
+}
+
+// Adds the address of the specified function to a cache, growing it as needed
+//
+static void cacheProc(_GLFWproccache* cache,
+                      const char* procname,
+                      uint32_t hash,
+                      GLFWglproc proc)
+{
+    // Keep the table at most half full so that probe sequences stay short
+    if (!cache->entries || (cache->count + 1) * 2 > cache->mask + 1)
     {
-        // Check if extension is in the old style OpenGL extensions string
+        const uint32_t size = cache->entries ? (cache->mask + 1) * 2 : 64;
+        _GLFWproccache grown = { NULL, size - 1, cache->count };
 
-        const char* extensions = (const char*)
-            window->context.GetString(GL_EXTENSIONS);
-        if (!extensions)
+        grown.entries = _glfw_calloc(size, sizeof(*grown.entries));
+        if (!grown.entries)
+            return;
+
+        for (uint32_t i = 0;  cache->entries && i <= cache->mask;  i++)
         {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "Extension string retrieval is broken");
-            return GLFW_FALSE;
+            if (!cache->entries[i].name)
+                continue;
+
+            uint32_t j = cache->entries[i].hash & grown.mask;
+            while (grown.entries[j].name)
+                j = (j + 1) & grown.mask;
+
+            grown.entries[j] = cache->entries[i];
         }
 
-        if (_glfwStringInExtensionString(extension, extensions))
-            return GLFW_TRUE;
+        _glfw_free(cache->entries);
+        *cache = grown;
     }
 
-    // Check if extension is in the platform-specific string
-    return window->context.extensionSupported(extension);
+    const size_t length = strlen(procname);
+    char* name = _glfw_calloc(length + 1, 1);
+    if (!name)
+        return;
+
+    memcpy(name, procname, length);
+
+    uint32_t i = hash & cache->mask;
+    while (cache->entries[i].name)
+        i = (i + 1) & cache->mask;
+
+    cache->entries[i].hash = hash;
+    cache->entries[i].name = name;
+    cache->entries[i].proc = proc;
+    cache->count++;
 }
 
-GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
+// Returns the address of the specified function for the current context of the
+// window, using the function cache of its context creation API where possible
+//
+// The caller must hold the function cache lock if the context has a cache
+//
+static GLFWglproc getProcAddress(_GLFWwindow* window, const char* procname)
 {
-    _GLFWwindow* window;
-    assert(procname != NULL);
+    _GLFWproccache* cache = window->context.procs;
+    if (!cache)
+        return window->context.getProcAddress(procname);
 
-    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    const uint32_t hash = hashString(procname, strlen(procname));
 
-    window = _glfwPlatformGetTls(&_glfw.contextSlot);
-    if (!window)
+    GLFWglproc proc = findCachedProc(cache, procname, hash);
+    if (!proc)
     {
-        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
-                        "Cannot query entry point without a current OpenGL or OpenGL ES context");
-        return NULL;
+        // NOTE: Failed lookups are not cached, as they are rare and may depend
+        //       on which extensions the current context supports
+        proc = window->context.getProcAddress(procname);
+        if (proc)
+            cacheProc(cache, procname, hash, proc);
+    }
+
+    return proc;
+}
+
+// Loads the functions used for framebuffer readback and creates the ring of
+// pixel buffer objects if the context supports them
+//
+static GLFWbool initReadback(_GLFWwindow* window)
+{
+    GLFWbool async = GLFW_FALSE;
+
+    window->context.readback.Finish = (PFNGLFINISHPROC)
+        window->context.getProcAddress("glFinish");
+    window->context.readback.PixelStorei = (PFNGLPIXELSTOREIPROC)
+        window->context.getProcAddress("glPixelStorei");
+    window->context.readback.ReadPixels = (PFNGLREADPIXELSPROC)
+        window->context.getProcAddress("glReadPixels");
+
+    if (!window->context.readback.Finish ||
+        !window->context.readback.PixelStorei ||
+        !window->context.readback.ReadPixels)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Entry points missing for framebuffer readback");
+        return GLFW_FALSE;
+    }
+
+    // NOTE: Fences and buffer mapping are core in OpenGL 3.2 and OpenGL ES 3.0
+    if (window->context.client == GLFW_OPENGL_API)
+    {
+        async = window->context.major > 3 ||
+                (window->context.major == 3 && window->context.minor >= 2);
+    }
+    else
+        async = window->context.major >= 3;
+
+    // NOTE: OSMesa renders straight into host memory that is read directly
+    if (window->context.source == GLFW_OSMESA_CONTEXT_API)
+        async = GLFW_FALSE;
+
+    if (async)
+    {
+        window->context.readback.GenBuffers = (PFNGLGENBUFFERSPROC)
+            window->context.getProcAddress("glGenBuffers");
+        window->context.readback.DeleteBuffers = (PFNGLDELETEBUFFERSPROC)
+            window->context.getProcAddress("glDeleteBuffers");
+        window->context.readback.BindBuffer = (PFNGLBINDBUFFERPROC)
+            window->context.getProcAddress("glBindBuffer");
+        window->context.readback.BufferData = (PFNGLBUFFERDATAPROC)
+            window->context.getProcAddress("glBufferData");
+        window->context.readback.MapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            window->context.getProcAddress("glMapBufferRange");
+        window->context.readback.UnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            window->context.getProcAddress("glUnmapBuffer");
+        window->context.readback.FenceSync = (PFNGLFENCESYNCPROC)
+            window->context.getProcAddress("glFenceSync");
+        window->context.readback.ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            window->context.getProcAddress("glClientWaitSync");
+        window->context.readback.DeleteSync = (PFNGLDELETESYNCPROC)
+            window->context.getProcAddress("glDeleteSync");
+
+        async = window->context.readback.GenBuffers &&
+                window->context.readback.DeleteBuffers &&
+                window->context.readback.BindBuffer &&
+                window->context.readback.BufferData &&
+                window->context.readback.MapBufferRange &&
+                window->context.readback.UnmapBuffer &&
+                window->context.readback.FenceSync &&
+                window->context.readback.ClientWaitSync &&
+                window->context.readback.DeleteSync;
     }
 
-    return window->context.getProcAddress(procname);
+    if (async)
+    {
+        for (int i = 0;  i < _GLFW_READBACK_SLOTS;  i++)
+        {
+            window->context.readback.GenBuffers(1,
+                &window->context.readback.slots[i].buffer);
+        }
+    }
+
+    // NOTE: OpenGL ES 2.0 only has the pack alignment parameter
+    if (window->context.client == GLFW_OPENGL_API || window->context.major >= 3)
+        window->context.readback.packParamCount = 4;
+    else
+        window->context.readback.packParamCount = 1;
+
+    window->context.readback.async = async;
+    window->context.readback.mapped = -1;
+    window->context.readback.initialized = GLFW_TRUE;
+    return GLFW_TRUE;
+}
+
+// The pixel pack parameters that affect the layout of read pixels
+//
+static const GLenum packParams[] =
+{
+    GL_PACK_ALIGNMENT,
+    GL_PACK_ROW_LENGTH,
+    GL_PACK_SKIP_PIXELS,
+    GL_PACK_SKIP_ROWS
+};
+
+// Saves the pixel pack parameters of the application and sets them for tightly
+// packed rows of four bytes per pixel
+//
+static void setPackParams(_GLFWwindow* window, GLint* saved)
+{
+    for (int i = 0;  i < window->context.readback.packParamCount;  i++)
+    {
+        window->context.GetIntegerv(packParams[i], saved + i);
+        window->context.readback.PixelStorei(packParams[i], i == 0 ? 4 : 0);
+    }
+}
+
+// Restores the pixel pack parameters of the application
+//
+static void restorePackParams(_GLFWwindow* window, const GLint* saved)
+{
+    for (int i = 0;  i < window->context.readback.packParamCount;  i++)
+        window->context.readback.PixelStorei(packParams[i], saved[i]);
+}
+
+// Reads the current read buffer into host memory and returns it
+//
+static const unsigned char* readFramebufferSync(_GLFWwindow* window,
+                                                int width, int height)
+{
+    const size_t size = (size_t) width * height * 4;
+
+    if (window->context.readback.size < size)
+    {
+        unsigned char* pixels = _glfw_realloc(window->context.readback.pixels, size);
+        if (!pixels)
+            return NULL;
+
+        window->context.readback.pixels = pixels;
+        window->context.readback.size = size;
+    }
+
+    GLint saved[4];
+    setPackParams(window, saved);
+    window->context.readback.ReadPixels(0, 0, width, height,
+                                        GL_RGBA, GL_UNSIGNED_BYTE,
+                                        window->context.readback.pixels);
+    restorePackParams(window, saved);
+
+    return window->context.readback.pixels;
+}
+
+// Queues a readback of the current read buffer into the next slot of the ring
+// and returns the oldest queued readback once the ring is full
+//
+static const unsigned char* readFramebufferAsync(_GLFWwindow* window,
+                                                 int width, int height,
+                                                 int* resultWidth,
+                                                 int* resultHeight)
+{
+    const size_t size = (size_t) width * height * 4;
+    const unsigned char* pixels = NULL;
+    GLint buffer, saved[4];
+
+    window->context.GetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &buffer);
+
+    // The slot handed out by the previous call is queued into next
+    if (window->context.readback.mapped != -1)
+    {
+        const int index = window->context.readback.mapped;
+        window->context.readback.BindBuffer(GL_PIXEL_PACK_BUFFER,
+                                            window->context.readback.slots[index].buffer);
+        window->context.readback.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        window->context.readback.mapped = -1;
+    }
+
+    {
+        const int index = window->context.readback.next;
+        assert(window->context.readback.slots[index].fence == NULL);
+
+        window->context.readback.BindBuffer(GL_PIXEL_PACK_BUFFER,
+                                            window->context.readback.slots[index].buffer);
+
+        // NOTE: Buffers only grow, so resizing back and forth does not
+        //       reallocate them every time
+        if (window->context.readback.slots[index].size < size)
+        {
+            window->context.readback.BufferData(GL_PIXEL_PACK_BUFFER,
+                                                size, NULL, GL_STREAM_READ);
+            window->context.readback.slots[index].size = size;
+        }
+
+        setPackParams(window, saved);
+        window->context.readback.ReadPixels(0, 0, width, height,
+                                            GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        restorePackParams(window, saved);
+
+        window->context.readback.slots[index].fence =
+            window->context.readback.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        window->context.readback.slots[index].width = width;
+        window->context.readback.slots[index].height = height;
+
+        window->context.readback.next = (index + 1) % _GLFW_READBACK_SLOTS;
+        window->context.readback.pending++;
+    }
+
+    if (window->context.readback.pending == _GLFW_READBACK_SLOTS)
+    {
+        // The oldest queued readback is in the slot that will be queued next
+        const int index = window->context.readback.next;
+        GLsync fence = window->context.readback.slots[index].fence;
+        GLenum result;
+
+        do
+        {
+            result = window->context.readback.ClientWaitSync(fence,
+                                                             GL_SYNC_FLUSH_COMMANDS_BIT,
+                                                             1000000000);
+        }
+        while (result == GL_TIMEOUT_EXPIRED);
+
+        window->context.readback.DeleteSync(fence);
+        window->context.readback.slots[index].fence = NULL;
+        window->context.readback.pending--;
+
+        if (result == GL_WAIT_FAILED)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Failed to wait for framebuffer readback");
+        }
+        else
+        {
+            window->context.readback.BindBuffer(GL_PIXEL_PACK_BUFFER,
+                                                window->context.readback.slots[index].buffer);
+
+            pixels = window->context.readback.MapBufferRange(GL_PIXEL_PACK_BUFFER,
+                0, (size_t) window->context.readback.slots[index].width *
+                   window->context.readback.slots[index].height * 4,
+                GL_MAP_READ_BIT);
+            if (pixels)
+            {
+                window->context.readback.mapped = index;
+                *resultWidth = window->context.readback.slots[index].width;
+                *resultHeight = window->context.readback.slots[index].height;
+            }
+            else
+            {
+                _glfwInputError(GLFW_PLATFORM_ERROR,
+                                "Failed to map framebuffer readback");
+            }
+        }
+    }
+    else
+    {
+        // NOTE: Submit the readback so the driver can start on it right away
+        window->context.Flush();
+    }
+
+    window->context.readback.BindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+    return pixels;
+}
+
+// Paces, records and submits a frame for the specified window
+//
+static void swapWindowBuffers(_GLFWwindow* window, const int* rects, int count)
+{
+    if (window->frameInterval)
+        waitForFrameDeadline(window);
+
+    window->timings.frame++;
+    window->timings.submitTime = _glfwPlatformGetTimerValue();
+
+    // Damage is only a hint, so contexts without support present everything
+    if (count > 0 && window->context.swapBuffersWithDamage)
+        window->context.swapBuffersWithDamage(window, rects, count);
+    else
+        window->context.swapBuffers(window);
+}
+
+// Makes the context of the specified window current for swapping its buffers
+// with glfwSwapBuffersMulti, as the swap interval applies to the current
+// context and EGL can only swap the buffers of the current context
+//
+static GLFWbool makeCurrentForSwap(_GLFWwindow* window, int index)
+{
+    if (window == _glfwPlatformGetTls(&_glfw.contextSlot))
+        return GLFW_TRUE;
+
+    glfwMakeContextCurrent((GLFWwindow*) window);
+    if (window != _glfwPlatformGetTls(&_glfw.contextSlot))
+    {
+        // The context may be current on another thread, so the buffers of
+        // this window are left unswapped and the rest still swapped
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to make the context of window %i current to swap its buffers",
+                        index);
+        return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GLFW public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWAPI GLFWwindow* glfwCreateOffscreenContext(int width, int height,
+                                               GLFWwindow* share)
+{
+    _GLFWfbconfig fbconfig;
+    _GLFWctxconfig ctxconfig;
+    _GLFWwindow* window;
+
+    assert(width >= 0);
+    assert(height >= 0);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    if (width <= 0 || height <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid offscreen context size %ix%i",
+                        width, height);
+        return NULL;
+    }
+
+    fbconfig  = _glfw.hints.framebuffer;
+    ctxconfig = _glfw.hints.context;
+
+    ctxconfig.share = (_GLFWwindow*) share;
+
+    // Offscreen surfaces are never composited
+    fbconfig.transparent = GLFW_FALSE;
+
+    if (ctxconfig.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot create an offscreen context without a client API");
+        return NULL;
+    }
+
+    if (!_glfwIsValidContextConfig(&ctxconfig))
+        return NULL;
+
+    window = _glfw_calloc(1, sizeof(_GLFWwindow));
+
+    _glfwPlatformLockMutex(&_glfw.windowLock);
+    window->next = _glfw.offscreenListHead;
+    _glfw.offscreenListHead = window;
+    _glfwPlatformUnlockMutex(&_glfw.windowLock);
+
+    window->offscreen       = GLFW_TRUE;
+    window->offscreenWidth  = width;
+    window->offscreenHeight = height;
+    window->doublebuffer    = fbconfig.doublebuffer;
+
+    if (!_glfw.platform.createOffscreenContext(window, &ctxconfig, &fbconfig) ||
+        !_glfwRefreshContextAttribs(window, &ctxconfig))
+    {
+        glfwDestroyWindow((GLFWwindow*) window);
+        return NULL;
+    }
+
+    return (GLFWwindow*) window;
+}
+
+GLFWAPI GLFWcontextpool* glfwCreateContextPool(int count, GLFWwindow* share)
+{
+    _GLFWcontextpool* pool;
+
+    assert(count >= 0);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    if (count <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid context pool size %i", count);
+        return NULL;
+    }
+
+    pool = _glfw_calloc(1, sizeof(_GLFWcontextpool));
+    pool->next = _glfw.contextPoolListHead;
+    _glfw.contextPoolListHead = pool;
+
+    pool->contexts = _glfw_calloc(count, sizeof(_GLFWwindow*));
+    pool->available = _glfw_calloc(count, sizeof(_GLFWwindow*));
+
+    if (!_glfwPlatformCreateMutex(&pool->lock))
+    {
+        glfwDestroyContextPool((GLFWcontextpool*) pool);
+        return NULL;
+    }
+
+    for (int i = 0;  i < count;  i++)
+    {
+        // Share with the first pooled context if there is nothing else to share
+        // with, so that all pooled contexts share objects with each other
+        GLFWwindow* target = share;
+        if (!target && i > 0)
+            target = (GLFWwindow*) pool->contexts[0];
+
+        _GLFWwindow* window =
+            (_GLFWwindow*) glfwCreateOffscreenContext(1, 1, target);
+        if (!window)
+        {
+            glfwDestroyContextPool((GLFWcontextpool*) pool);
+            return NULL;
+        }
+
+        window->pool = pool;
+        pool->contexts[pool->count++] = window;
+        pool->available[pool->availableCount++] = window;
+    }
+
+    return (GLFWcontextpool*) pool;
+}
+
+GLFWAPI void glfwDestroyContextPool(GLFWcontextpool* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWcontextpool* pool = (_GLFWcontextpool*) handle;
+
+    // Allow destroying of NULL (to match the behavior of free)
+    if (pool == NULL)
+        return;
+
+    for (int i = 0;  i < pool->count;  i++)
+    {
+        // Pooled contexts may only be destroyed by their pool
+        pool->contexts[i]->pool = NULL;
+        glfwDestroyWindow((GLFWwindow*) pool->contexts[i]);
+    }
+
+    _glfwPlatformDestroyMutex(&pool->lock);
+
+    // Unlink pool from global linked list
+    {
+        _GLFWcontextpool** prev = &_glfw.contextPoolListHead;
+
+        while (*prev != pool)
+            prev = &((*prev)->next);
+
+        *prev = pool->next;
+    }
+
+    _glfw_free(pool->contexts);
+    _glfw_free(pool->available);
+    _glfw_free(pool);
+}
+
+GLFWAPI GLFWwindow* glfwAcquirePooledContext(GLFWcontextpool* handle)
+{
+    _GLFWwindow* window = NULL;
+    _GLFWwindow* previous;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    _GLFWcontextpool* pool = (_GLFWcontextpool*) handle;
+    assert(pool != NULL);
+
+    _GLFWerror* thread = _glfwGetThreadError();
+    previous = _glfwPlatformGetTls(&_glfw.contextSlot);
+
+    _glfwPlatformLockMutex(&pool->lock);
+
+    if (pool->availableCount)
+        window = pool->available[--pool->availableCount];
+
+    _glfwPlatformUnlockMutex(&pool->lock);
+
+    if (!window)
+        return NULL;
+
+    glfwMakeContextCurrent((GLFWwindow*) window);
+
+    _glfwPlatformLockMutex(&pool->lock);
+
+    // The context is only handed out if it could be made current, otherwise it
+    // is returned to the bottom of the pool so that the contexts that are still
+    // available are tried first by later attempts
+    if (_glfwPlatformGetTls(&_glfw.contextSlot) == window)
+    {
+        window->acquired = GLFW_TRUE;
+        window->acquirer = thread;
+    }
+    else
+    {
+        memmove(pool->available + 1,
+                pool->available,
+                pool->availableCount * sizeof(_GLFWwindow*));
+        pool->available[0] = window;
+        pool->availableCount++;
+        window = NULL;
+    }
+
+    _glfwPlatformUnlockMutex(&pool->lock);
+
+    if (!window && previous != _glfwPlatformGetTls(&_glfw.contextSlot))
+        glfwMakeContextCurrent((GLFWwindow*) previous);
+
+    return (GLFWwindow*) window;
+}
+
+GLFWAPI void glfwReleasePooledContext(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    _GLFWcontextpool* pool = window->pool;
+    if (!pool)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Context does not belong to a pool");
+        return;
+    }
+
+    _GLFWerror* thread = _glfwGetThreadError();
+
+    _glfwPlatformLockMutex(&pool->lock);
+    const GLFWbool owned = window->acquired && window->acquirer == thread;
+    _glfwPlatformUnlockMutex(&pool->lock);
+
+    // NOTE: A context released by another thread could still be current on the
+    //       thread that acquired it when it is handed out again
+    if (!owned)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Pooled context was not acquired by the calling thread");
+        return;
+    }
+
+    if (window == _glfwPlatformGetTls(&_glfw.contextSlot))
+        glfwMakeContextCurrent(NULL);
+
+    _glfwPlatformLockMutex(&pool->lock);
+
+    window->acquired = GLFW_FALSE;
+    window->acquirer = NULL;
+    pool->available[pool->availableCount++] = window;
+
+    _glfwPlatformUnlockMutex(&pool->lock);
+}
+
+GLFWAPI void glfwMakeContextCurrent(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    _GLFWwindow* previous;
+
+    previous = _glfwPlatformGetTls(&_glfw.contextSlot);
+
+    if (window && window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot make current with a window that has no OpenGL or OpenGL ES context");
+        return;
+    }
+
+    if (previous)
+    {
+        if (!window || window->context.source != previous->context.source)
+            previous->context.makeCurrent(NULL);
+    }
+
+    if (window)
+        window->context.makeCurrent(window);
+}
+
+GLFWAPI GLFWwindow* glfwGetCurrentContext(void)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    return _glfwPlatformGetTls(&_glfw.contextSlot);
+}
+
+GLFWAPI void glfwSwapBuffers(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot swap buffers of a window that has no OpenGL or OpenGL ES context");
+        return;
+    }
+
+    swapWindowBuffers(window, NULL, 0);
+}
+
+GLFWAPI void glfwSwapBuffersWithDamage(GLFWwindow* handle,
+                                       const int* rects, int count)
+{
+    assert(count >= 0);
+    assert(rects != NULL || count == 0);
+
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid damage rectangle count %i", count);
+        return;
+    }
+
+    if (window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot swap buffers of a window that has no OpenGL or OpenGL ES context");
+        return;
+    }
+
+    swapWindowBuffers(window, rects, count);
+}
+
+GLFWAPI int glfwGetBufferAge(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot query the buffer age of a window that has no OpenGL or OpenGL ES context");
+        return 0;
+    }
+
+    if (!window->context.getBufferAge)
+        return 0;
+
+    return window->context.getBufferAge(window);
+}
+
+GLFWAPI void glfwSwapBuffersMulti(GLFWwindow** handles, int count)
+{
+    _GLFWwindow* previous;
+    int i;
+
+    assert(count >= 0);
+    assert(handles != NULL || count == 0);
+
+    _GLFW_REQUIRE_INIT();
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid window count %i", count);
+        return;
+    }
+
+    for (i = 0;  i < count;  i++)
+    {
+        _GLFWwindow* window = (_GLFWwindow*) handles[i];
+        assert(window != NULL);
+
+        if (window->context.client == GLFW_NO_API)
+        {
+            _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                            "Cannot swap buffers of a window that has no OpenGL or OpenGL ES context");
+            return;
+        }
+    }
+
+    previous = _glfwPlatformGetTls(&_glfw.contextSlot);
+
+    // NOTE: Only the last window that can be made current waits for the swap
+    //       interval, so that all windows are presented in the same vertical
+    //       blank instead of one after the other
+    int last = count - 1;
+    while (last >= 0 && !makeCurrentForSwap((_GLFWwindow*) handles[last], last))
+        last--;
+
+    for (i = 0;  i < last;  i++)
+    {
+        _GLFWwindow* window = (_GLFWwindow*) handles[i];
+        if (!makeCurrentForSwap(window, i))
+            continue;
+
+        const GLFWbool immediate = window->context.interval != 0;
+
+        if (immediate && window->context.skipSwapWait)
+        {
+            window->context.skipSwapWait(window);
+            swapWindowBuffers(window, NULL, 0);
+            continue;
+        }
+
+        if (immediate)
+            window->context.swapInterval(0);
+
+        swapWindowBuffers(window, NULL, 0);
+
+        if (immediate)
+            window->context.swapInterval(window->context.interval);
+    }
+
+    if (last >= 0)
+    {
+        _GLFWwindow* window = (_GLFWwindow*) handles[last];
+        if (makeCurrentForSwap(window, last))
+            swapWindowBuffers(window, NULL, 0);
+    }
+
+    if (previous != _glfwPlatformGetTls(&_glfw.contextSlot))
+        glfwMakeContextCurrent((GLFWwindow*) previous);
+}
+
+GLFWAPI void glfwSwapBuffersAndPoll(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot swap buffers of a window that has no OpenGL or OpenGL ES context");
+        return;
+    }
+
+    // NOTE: Events are not processed during the swap, as their callbacks could
+    //       destroy the window or change the current context
+    swapWindowBuffers(window, NULL, 0);
+
+    // NOTE: The frame rate limiter waits for the next frame deadline after the
+    //       swap instead of before the next one, so that events are processed
+    //       during the wait; the window is not used after they have been
+    if (window->frameInterval)
+        waitUntilDeadline(window->frameDeadline, GLFW_TRUE);
+
+    _glfw.platform.pollEvents();
+}
+
+GLFWAPI int glfwGetFrameTimings(GLFWwindow* handle, GLFWframetimings* timings)
+{
+    assert(timings != NULL);
+
+    memset(timings, 0, sizeof(GLFWframetimings));
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot query frame timings of a window that has no OpenGL or OpenGL ES context");
+        return GLFW_FALSE;
+    }
+
+    GLFWbool available = GLFW_FALSE;
+    if (window->context.getFrameTimings)
+        available = window->context.getFrameTimings(window);
+
+    *timings = window->timings;
+    return available;
+}
+
+GLFWAPI const unsigned char* glfwReadFramebufferAsync(GLFWwindow* handle,
+                                                     int* width,
+                                                     int* height)
+{
+    int fbwidth, fbheight;
+    const unsigned char* pixels;
+
+    if (width)
+        *width = 0;
+    if (height)
+        *height = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot read the framebuffer of a window that has no OpenGL or OpenGL ES context");
+        return NULL;
+    }
+
+    if (window != _glfwPlatformGetTls(&_glfw.contextSlot))
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "Cannot read the framebuffer of a window whose context is not current");
+        return NULL;
+    }
+
+    if (!window->context.readback.initialized)
+    {
+        if (!initReadback(window))
+            return NULL;
+    }
+
+    if (window->context.source == GLFW_OSMESA_CONTEXT_API &&
+        window->context.osmesa.format == OSMESA_RGBA &&
+        window->context.osmesa.type == GL_UNSIGNED_BYTE)
+    {
+        // NOTE: The OSMesa color buffer is host memory, so it only needs to be
+        //       finished before being handed out
+        const int back = window->context.osmesa.back;
+        window->context.readback.Finish();
+
+        if (width)
+            *width = window->context.osmesa.widths[back];
+        if (height)
+            *height = window->context.osmesa.heights[back];
+
+        return window->context.osmesa.buffers[back];
+    }
+
+    glfwGetFramebufferSize(handle, &fbwidth, &fbheight);
+    if (!fbwidth || !fbheight)
+        return NULL;
+
+    if (window->context.readback.async)
+    {
+        int resultWidth = 0, resultHeight = 0;
+        pixels = readFramebufferAsync(window, fbwidth, fbheight,
+                                      &resultWidth, &resultHeight);
+        fbwidth = resultWidth;
+        fbheight = resultHeight;
+    }
+    else
+        pixels = readFramebufferSync(window, fbwidth, fbheight);
+
+    if (pixels)
+    {
+        if (width)
+            *width = fbwidth;
+        if (height)
+            *height = fbheight;
+    }
+
+    return pixels;
+}
+
+GLFWAPI void glfwSwapInterval(int interval)
+{
+    _GLFWwindow* window;
+
+    _GLFW_REQUIRE_INIT();
+
+    window = _glfwPlatformGetTls(&_glfw.contextSlot);
+    if (!window)
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "Cannot set swap interval without a current OpenGL or OpenGL ES context");
+        return;
+    }
+
+    window->context.swapInterval(interval);
+    window->context.interval = interval;
+}
+
+GLFWAPI void glfwSetFrameRateTarget(GLFWwindow* handle, double rate)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(isfinite(rate));
+    assert(rate >= 0.0);
+
+    if (!isfinite(rate) || rate < 0.0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid frame rate %f", rate);
+        return;
+    }
+
+    window->frameInterval = 0;
+
+    if (rate > 0.0)
+    {
+        const double interval = _glfwPlatformGetTimerFrequency() / rate;
+        if (interval < (double) (UINT64_MAX / 2))
+            window->frameInterval = (uint64_t) interval;
+        else
+            window->frameInterval = UINT64_MAX / 2;
+    }
+
+    window->frameDeadline = 0;
+}
+
+GLFWAPI int glfwExtensionSupported(const char* extension)
+{
+    _GLFWwindow* window;
+    assert(extension != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    window = _glfwPlatformGetTls(&_glfw.contextSlot);
+    if (!window)
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "Cannot query extension without a current OpenGL or OpenGL ES context");
+        return GLFW_FALSE;
+    }
+
+    if (*extension == '\0')
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Extension name cannot be an empty string");
+        return GLFW_FALSE;
+    }
+
+    if (window->context.extensions.offsets)
+    {
+        // Check if extension is in the set parsed at context creation
+        if (_glfwExtensionInSet(&window->context.extensions, extension))
+            return GLFW_TRUE;
+    }
+    else if (window->context.major >= 3)
+    {
+        int i;
+        GLint count;
+
+        // Check if extension is in the modern OpenGL extensions string list
+
+        window->context.GetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        for (i = 0;  i < count;  i++)
+        {
+            const char* en = (const char*)
+                window->context.GetStringi(GL_EXTENSIONS, i);
+            if (!en)
+            {
+                _glfwInputError(GLFW_PLATFORM_ERROR,
+                                "Extension string retrieval is broken");
+                return GLFW_FALSE;
+            }
+
+            if (strcmp(en, extension) == 0)
+                return GLFW_TRUE;
+        }
+    }
+    else
+    {
+        // Check if extension is in the old style OpenGL extensions string
+
+        const char* extensions = (const char*)
+            window->context.GetString(GL_EXTENSIONS);
+        if (!extensions)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Extension string retrieval is broken");
+            return GLFW_FALSE;
+        }
+
+        if (_glfwStringInExtensionString(extension, extensions))
+            return GLFW_TRUE;
+    }
+
+    // Check if extension is in the platform-specific string
+    return window->context.extensionSupported(extension);
+}
+
+GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
+{
+    _GLFWwindow* window;
+    assert(procname != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    window = _glfwPlatformGetTls(&_glfw.contextSlot);
+    if (!window)
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "Cannot query entry point without a current OpenGL or OpenGL ES context");
+        return NULL;
+    }
+
+    if (!window->context.procs)
+        return window->context.getProcAddress(procname);
+
+    _glfwPlatformLockMutex(&_glfw.procLock);
+    const GLFWglproc proc = getProcAddress(window, procname);
+    _glfwPlatformUnlockMutex(&_glfw.procLock);
+    return proc;
+}
+
+GLFWAPI int glfwGetProcAddresses(const char* const* procnames,
+                                 GLFWglproc* procs,
+                                 int count)
+{
+    _GLFWwindow* window;
+    int found = 0;
+
+    assert(count >= 0);
+    assert(count == 0 || procnames != NULL);
+    assert(count == 0 || procs != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid function count %i", count);
+        return 0;
+    }
+
+    if (count == 0)
+        return 0;
+
+    if (!procnames || !procs)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid function array");
+        return 0;
+    }
+
+    window = _glfwPlatformGetTls(&_glfw.contextSlot);
+    if (!window)
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "Cannot query entry points without a current OpenGL or OpenGL ES context");
+        memset(procs, 0, count * sizeof(GLFWglproc));
+        return 0;
+    }
+
+    // NOTE: The lock is taken once for the whole batch, as loaders resolve
+    //       thousands of functions for each context
+    if (window->context.procs)
+        _glfwPlatformLockMutex(&_glfw.procLock);
+
+    for (int i = 0;  i < count;  i++)
+    {
+        assert(procnames[i] != NULL);
+
+        procs[i] = getProcAddress(window, procnames[i]);
+        if (procs[i])
+            found++;
+    }
+
+    if (window->context.procs)
+        _glfwPlatformUnlockMutex(&_glfw.procLock);
+
+    return found;
 }
 
@@ -83,38 +83,22 @@ static int getEGLConfigAttrib(EGLConfig config, int attrib)
     return value;
 }
 
-// Return the EGLConfig most closely matching the specified hints
+// Combines renderable and surface type bits into the type bits of the
+// framebuffer configuration cache
 //
-static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
-                                const _GLFWfbconfig* fbconfig,
-                                EGLConfig* result)
+static int getEGLConfigTypes(int renderableType, int surfaceType)
 {
-    EGLConfig* nativeConfigs;
-    _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
-    int i, nativeCount, usableCount, apiBit, surfaceTypeBit;
-    GLFWbool wrongApiAvailable = GLFW_FALSE;
-
-    if (ctxconfig->client == GLFW_OPENGL_ES_API)
-    {
-        if (ctxconfig->major == 1)
-            apiBit = EGL_OPENGL_ES_BIT;
-        else
-            apiBit = EGL_OPENGL_ES2_BIT;
-    }
-    else
-        apiBit = EGL_OPENGL_BIT;
-
-    if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
-        surfaceTypeBit = EGL_PBUFFER_BIT;
-    else
-        surfaceTypeBit = EGL_WINDOW_BIT;
+    return (renderableType & 0xffff) | ((surfaceType & 0x7fff) << 16);
+}
 
-    if (fbconfig->stereo)
-    {
-        _glfwInputError(GLFW_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
-        return GLFW_FALSE;
-    }
+// Translates the EGLConfigs of the display into the framebuffer configuration
+// cache
+//
+static GLFWbool loadEGLConfigs(void)
+{
+    EGLConfig* nativeConfigs;
+    _GLFWfbconfigcache* cache = &_glfw.egl.fbconfigs;
+    int nativeCount;
 
     eglGetConfigs(_glfw.egl.display, NULL, 0, &nativeCount);
     if (!nativeCount)
@@ -126,21 +110,19 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
     nativeConfigs = _glfw_calloc(nativeCount, sizeof(EGLConfig));
     eglGetConfigs(_glfw.egl.display, nativeConfigs, nativeCount, &nativeCount);
 
-    usableConfigs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
-    usableCount = 0;
+    cache->configs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
+    cache->types = _glfw_calloc(nativeCount, sizeof(int));
+    cache->count = 0;
 
-    for (i = 0;  i < nativeCount;  i++)
+    for (int i = 0;  i < nativeCount;  i++)
     {
         const EGLConfig n = nativeConfigs[i];
-        _GLFWfbconfig* u = usableConfigs + usableCount;
+        _GLFWfbconfig* u = cache->configs + cache->count;
 
         // Only consider RGB(A) EGLConfigs
         if (getEGLConfigAttrib(n, EGL_COLOR_BUFFER_TYPE) != EGL_RGB_BUFFER)
             continue;
 
-        if (!(getEGLConfigAttrib(n, EGL_SURFACE_TYPE) & surfaceTypeBit))
-            continue;
-
 #if defined(_GLFW_X11)
         if (_glfw.platform.platformID == GLFW_PLATFORM_X11)
         {
@@ -151,25 +133,20 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
             if (!vi.visualid)
                 continue;
 
-            if (fbconfig->transparent)
+            int count;
+            XVisualInfo* vis =
+                XGetVisualInfo(_glfw.x11.display, VisualIDMask, &vi, &count);
+            if (vis)
             {
-                int count;
-                XVisualInfo* vis =
-                    XGetVisualInfo(_glfw.x11.display, VisualIDMask, &vi, &count);
-                if (vis)
-                {
-                    u->transparent = _glfwIsVisualTransparentX11(vis[0].visual);
-                    XFree(vis);
-                }
+                u->transparent = _glfwIsVisualTransparentX11(vis[0].visual);
+                XFree(vis);
             }
         }
 #endif // _GLFW_X11
 
-        if (!(getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE) & apiBit))
-        {
-            wrongApiAvailable = GLFW_TRUE;
-            continue;
-        }
+        cache->types[cache->count] =
+            getEGLConfigTypes(getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE),
+                              getEGLConfigAttrib(n, EGL_SURFACE_TYPE));
 
         u->redBits = getEGLConfigAttrib(n, EGL_RED_SIZE);
         u->greenBits = getEGLConfigAttrib(n, EGL_GREEN_SIZE);
@@ -179,6 +156,81 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         u->depthBits = getEGLConfigAttrib(n, EGL_DEPTH_SIZE);
         u->stencilBits = getEGLConfigAttrib(n, EGL_STENCIL_SIZE);
 
+        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
+
+        u->handle = (uintptr_t) n;
+        cache->count++;
+    }
+
+    _glfw_free(nativeConfigs);
+    return GLFW_TRUE;
+}
+
+// Return the EGLConfig most closely matching the specified hints
+//
+static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
+                                const _GLFWfbconfig* fbconfig,
+                                GLFWbool offscreen,
+                                EGLConfig* result)
+{
+    _GLFWfbconfigcache* cache = &_glfw.egl.fbconfigs;
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    int i, usableCount, apiBit, surfaceTypeBit, types;
+    GLFWbool wrongApiAvailable = GLFW_FALSE;
+    uintptr_t handle;
+
+    if (ctxconfig->client == GLFW_OPENGL_ES_API)
+    {
+        if (ctxconfig->major == 1)
+            apiBit = EGL_OPENGL_ES_BIT;
+        else
+            apiBit = EGL_OPENGL_ES2_BIT;
+    }
+    else
+        apiBit = EGL_OPENGL_BIT;
+
+    if (offscreen || _glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
+        surfaceTypeBit = EGL_PBUFFER_BIT;
+    else
+        surfaceTypeBit = EGL_WINDOW_BIT;
+
+    if (fbconfig->stereo)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
+        return GLFW_FALSE;
+    }
+
+    types = getEGLConfigTypes(apiBit, surfaceTypeBit);
+
+    if (_glfwFindFBConfigChoice(cache, fbconfig, types, &handle))
+    {
+        *result = (EGLConfig) handle;
+        return GLFW_TRUE;
+    }
+
+    if (!cache->configs)
+    {
+        if (!loadEGLConfigs())
+            return GLFW_FALSE;
+    }
+
+    usableConfigs = _glfw_calloc(cache->count, sizeof(_GLFWfbconfig));
+    usableCount = 0;
+
+    for (i = 0;  i < cache->count;  i++)
+    {
+        _GLFWfbconfig* u = usableConfigs + usableCount;
+
+        if (!(cache->types[i] & getEGLConfigTypes(0, surfaceTypeBit)))
+            continue;
+
+        if (!(cache->types[i] & getEGLConfigTypes(apiBit, 0)))
+        {
+            wrongApiAvailable = GLFW_TRUE;
+            continue;
+        }
+
 #if defined(_GLFW_WAYLAND)
         if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
         {
@@ -188,22 +240,28 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
             //       with an alpha channel to ensure the buffer is opaque
             if (!_glfw.egl.EXT_present_opaque)
             {
-                if (!fbconfig->transparent && u->alphaBits > 0)
+                if (!fbconfig->transparent && cache->configs[i].alphaBits > 0)
                     continue;
             }
         }
 #endif // _GLFW_WAYLAND
 
-        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
+        *u = cache->configs[i];
         u->doublebuffer = fbconfig->doublebuffer;
 
-        u->handle = (uintptr_t) n;
+        // Only weigh transparency when it was requested
+        if (!fbconfig->transparent)
+            u->transparent = GLFW_FALSE;
+
         usableCount++;
     }
 
     closest = _glfwChooseFBConfig(fbconfig, usableConfigs, usableCount);
     if (closest)
+    {
         *result = (EGLConfig) closest->handle;
+        _glfwAddFBConfigChoice(cache, fbconfig, types, closest->handle);
+    }
     else
     {
         if (wrongApiAvailable)
@@ -234,7 +292,6 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         }
     }
 
-    _glfw_free(nativeConfigs);
     _glfw_free(usableConfigs);
 
     return closest != NULL;
@@ -278,7 +335,8 @@ static void makeContextCurrentEGL(_GLFWwindow* window)
     _glfwPlatformSetTls(&_glfw.contextSlot, window);
 }
 
-static void swapBuffersEGL(_GLFWwindow* window)
+static void swapBuffersWithDamageEGL(_GLFWwindow* window,
+                                     const int* rects, int count)
 {
     if (window != _glfwPlatformGetTls(&_glfw.contextSlot))
     {
@@ -291,21 +349,132 @@ static void swapBuffersEGL(_GLFWwindow* window)
     if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
     {
         // NOTE: Swapping buffers on a hidden window on Wayland makes it visible
-        if (!window->wl.visible)
+        //       and doing so before its initial configure event is a protocol
+        //       error, but waiting for that event here would dispatch window
+        //       callbacks in the middle of the swap, so the frame is skipped
+        const GLFWbool wait = window->wl.egl.interval > 0 &&
+                              !window->wl.egl.skipWait;
+        window->wl.egl.skipWait = GLFW_FALSE;
+
+        if (window->wl.configureSync || !window->wl.visible)
             return;
 
         // NOTE: We wait for a frame manually so we can add a timeout,
         //       as the EGL implementation will wait indefinitely
-        if (window->wl.egl.interval > 0)
+        if (wait)
         {
             window->context.Flush();
             if (!_glfwWaitForEGLFrameWayland(window))
                 return;
         }
+
+        _glfwRequestPresentationFeedbackWayland(window);
     }
 #endif
 
-    eglSwapBuffers(_glfw.egl.display, window->context.egl.surface);
+    if (window->context.egl.timestamps)
+    {
+        EGLuint64KHR id;
+        if (!eglGetNextFrameIdANDROID(_glfw.egl.display,
+                                      window->context.egl.surface,
+                                      &id))
+        {
+            id = 0;
+        }
+
+        window->context.egl.frameIds[window->timings.frame % 4] = id;
+    }
+
+    if (count > 0 && _glfw.egl.KHR_swap_buffers_with_damage)
+    {
+        eglSwapBuffersWithDamageKHR(_glfw.egl.display,
+                                    window->context.egl.surface,
+                                    rects, count);
+    }
+    else
+        eglSwapBuffers(_glfw.egl.display, window->context.egl.surface);
+}
+
+static void swapBuffersEGL(_GLFWwindow* window)
+{
+    swapBuffersWithDamageEGL(window, NULL, 0);
+}
+
+static int getBufferAgeEGL(_GLFWwindow* window)
+{
+    EGLint age;
+
+    if (!_glfw.egl.EXT_buffer_age)
+        return 0;
+
+    if (!eglQuerySurface(_glfw.egl.display,
+                         window->context.egl.surface,
+                         EGL_BUFFER_AGE_EXT,
+                         &age))
+    {
+        return 0;
+    }
+
+    return age;
+}
+
+static GLFWbool getFrameTimingsEGL(_GLFWwindow* window)
+{
+#if defined(_GLFW_WAYLAND)
+    if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
+        return _glfwGetFrameTimingsWayland(window);
+#endif
+
+    if (!window->context.egl.timestamps)
+        return GLFW_FALSE;
+
+    const EGLint intervalName = EGL_COMPOSITE_INTERVAL_ANDROID;
+    EGLnsecsANDROID interval;
+
+    if (eglGetCompositorTimingANDROID(_glfw.egl.display,
+                                      window->context.egl.surface,
+                                      1, &intervalName, &interval) &&
+        interval > 0)
+    {
+        window->timings.refreshInterval =
+            (uint64_t) interval * _glfwPlatformGetTimerFrequency() / 1000000000;
+    }
+
+    // Find the most recent frame still tracked that has been presented
+    for (uint64_t frame = window->timings.frame;
+         frame > window->timings.presentedFrame && window->timings.frame - frame < 4;
+         frame--)
+    {
+        const EGLuint64KHR id = window->context.egl.frameIds[frame % 4];
+        const EGLint presentName = EGL_DISPLAY_PRESENT_TIME_ANDROID;
+        EGLnsecsANDROID time;
+        uint64_t presentTime;
+
+        if (!id)
+            continue;
+
+        if (!eglGetFrameTimestampsANDROID(_glfw.egl.display,
+                                          window->context.egl.surface,
+                                          id, 1, &presentName, &time))
+        {
+            continue;
+        }
+
+        // NOTE: The timestamp may also be pending or invalid
+        if (time < 0 ||
+            !_glfwPlatformConvertMonotonicTime((uint64_t) time, &presentTime))
+        {
+            continue;
+        }
+
+        // NOTE: The display present time is the start of the scanout
+        window->timings.presentedFrame = frame;
+        window->timings.presentTime = presentTime;
+        window->timings.vblankTime = presentTime;
+        break;
+    }
+
+    return window->timings.presentedFrame != 0;
 }
 
 static void swapIntervalEGL(int interval)
@@ -315,7 +484,7 @@ static void swapIntervalEGL(int interval)
     {
         _GLFWwindow* window = _glfwPlatformGetTls(&_glfw.contextSlot);
         assert(window != NULL);
-        window->wl.egl.interval = interval;
+        _glfwSetSwapIntervalWayland(window, interval);
         return;
     }
 #endif
@@ -323,8 +492,18 @@ static void swapIntervalEGL(int interval)
     eglSwapInterval(_glfw.egl.display, interval);
 }
 
+#if defined(_GLFW_WAYLAND)
+static void skipSwapWaitEGL(_GLFWwindow* window)
+{
+    window->wl.egl.skipWait = GLFW_TRUE;
+}
+#endif
+
 static int extensionSupportedEGL(const char* extension)
 {
+    if (_glfw.egl.extensions.offsets)
+        return _glfwExtensionInSet(&_glfw.egl.extensions, extension);
+
     const char* extensions = eglQueryString(_glfw.egl.display, EGL_EXTENSIONS);
     if (extensions)
     {
@@ -457,6 +636,10 @@ GLFWbool _glfwInitEGL(void)
         _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglQueryString");
     _glfw.egl.GetProcAddress = (PFN_eglGetProcAddress)
         _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglGetProcAddress");
+    _glfw.egl.SurfaceAttrib = (PFN_eglSurfaceAttrib)
+        _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglSurfaceAttrib");
+    _glfw.egl.QuerySurface = (PFN_eglQuerySurface)
+        _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglQuerySurface");
 
     if (!_glfw.egl.GetConfigAttrib ||
         !_glfw.egl.GetConfigs ||
@@ -474,6 +657,7 @@ GLFWbool _glfwInitEGL(void)
         !_glfw.egl.SwapBuffers ||
         !_glfw.egl.SwapInterval ||
         !_glfw.egl.QueryString ||
+        !_glfw.egl.QuerySurface ||
         !_glfw.egl.GetProcAddress)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
@@ -550,6 +734,10 @@ GLFWbool _glfwInitEGL(void)
         return GLFW_FALSE;
     }
 
+    extensions = eglQueryString(_glfw.egl.display, EGL_EXTENSIONS);
+    if (extensions)
+        _glfwParseExtensionSet(&_glfw.egl.extensions, extensions);
+
     _glfw.egl.KHR_create_context =
         extensionSupportedEGL("EGL_KHR_create_context");
     _glfw.egl.KHR_create_context_no_error =
@@ -563,11 +751,49 @@ GLFWbool _glfwInitEGL(void)
     _glfw.egl.EXT_present_opaque =
         extensionSupportedEGL("EGL_EXT_present_opaque");
 
+    if (extensionSupportedEGL("EGL_ANDROID_get_frame_timestamps"))
+    {
+        _glfw.egl.GetNextFrameIdANDROID = (PFNEGLGETNEXTFRAMEIDANDROIDPROC)
+            eglGetProcAddress("eglGetNextFrameIdANDROID");
+        _glfw.egl.GetCompositorTimingANDROID = (PFNEGLGETCOMPOSITORTIMINGANDROIDPROC)
+            eglGetProcAddress("eglGetCompositorTimingANDROID");
+        _glfw.egl.GetFrameTimestampsANDROID = (PFNEGLGETFRAMETIMESTAMPSANDROIDPROC)
+            eglGetProcAddress("eglGetFrameTimestampsANDROID");
+
+        _glfw.egl.ANDROID_get_frame_timestamps =
+            _glfw.egl.SurfaceAttrib &&
+            _glfw.egl.GetNextFrameIdANDROID &&
+            _glfw.egl.GetCompositorTimingANDROID &&
+            _glfw.egl.GetFrameTimestampsANDROID;
+    }
+
+    if (extensionSupportedEGL("EGL_KHR_swap_buffers_with_damage"))
+    {
+        _glfw.egl.SwapBuffersWithDamageKHR = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)
+            eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+    }
+    else if (extensionSupportedEGL("EGL_EXT_swap_buffers_with_damage"))
+    {
+        _glfw.egl.SwapBuffersWithDamageKHR = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)
+            eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+    }
+
+    _glfw.egl.KHR_swap_buffers_with_damage =
+        _glfw.egl.SwapBuffersWithDamageKHR != NULL;
+    _glfw.egl.EXT_buffer_age =
+        extensionSupportedEGL("EGL_EXT_buffer_age");
+
     return GLFW_TRUE;
 }
 
 void _glfwTerminateEGL(void)
 {
+    _glfwFreeExtensionSet(&_glfw.egl.extensions);
+    _glfwFreeFBConfigCache(&_glfw.egl.fbconfigs);
+
+    for (int i = 0;  i < 3;  i++)
+        _glfwFreeProcCache(&_glfw.egl.procs[i]);
+
     if (_glfw.egl.display)
     {
         eglTerminate(_glfw.egl.display);
@@ -608,7 +834,7 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
     if (ctxconfig->share)
         share = ctxconfig->share->context.egl.handle;
 
-    if (!chooseEGLConfig(ctxconfig, fbconfig, &config))
+    if (!chooseEGLConfig(ctxconfig, fbconfig, window->offscreen, &config))
         return GLFW_FALSE;
 
     if (ctxconfig->client == GLFW_OPENGL_ES_API)
@@ -726,16 +952,22 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
             SET_ATTRIB(EGL_GL_COLORSPACE_KHR, EGL_GL_COLORSPACE_SRGB_KHR);
     }
 
-    if (!fbconfig->doublebuffer)
+    // NOTE: Pbuffer surfaces are always single buffered
+    if (!fbconfig->doublebuffer && !window->offscreen)
         SET_ATTRIB(EGL_RENDER_BUFFER, EGL_SINGLE_BUFFER);
 
-    if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
+    if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND && !window->offscreen)
     {
         if (_glfw.egl.EXT_present_opaque)
             SET_ATTRIB(EGL_PRESENT_OPAQUE_EXT, !fbconfig->transparent);
     }
 
-    if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
+    if (window->offscreen)
+    {
+        SET_ATTRIB(EGL_WIDTH, window->offscreenWidth);
+        SET_ATTRIB(EGL_HEIGHT, window->offscreenHeight);
+    }
+    else if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
     {
         int width, height;
         _glfw.platform.getFramebufferSize(window, &width, &height);
@@ -746,23 +978,24 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
 
     SET_ATTRIB(EGL_NONE, EGL_NONE);
 
-    native = _glfw.platform.getEGLNativeWindow(window);
-    if (!_glfw.egl.platform || _glfw.egl.platform == EGL_PLATFORM_ANGLE_ANGLE)
+    if (window->offscreen || _glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
+    {
+        // HACK: Use a pbuffer surface as the default framebuffer
+        window->context.egl.surface =
+            eglCreatePbufferSurface(_glfw.egl.display, config, attribs);
+    }
+    else if (!_glfw.egl.platform || _glfw.egl.platform == EGL_PLATFORM_ANGLE_ANGLE)
     {
         // HACK: Also use non-platform function for ANGLE, as it does not
         //       implement eglCreatePlatformWindowSurfaceEXT despite reporting
         //       support for EGL_EXT_platform_base
+        native = _glfw.platform.getEGLNativeWindow(window);
         window->context.egl.surface =
             eglCreateWindowSurface(_glfw.egl.display, config, native, attribs);
     }
-    else if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
-    {
-        // HACK: Use a pbuffer surface as the default framebuffer
-        window->context.egl.surface =
-            eglCreatePbufferSurface(_glfw.egl.display, config, attribs);
-    }
     else
     {
+        native = _glfw.platform.getEGLNativeWindow(window);
         window->context.egl.surface =
             eglCreatePlatformWindowSurfaceEXT(_glfw.egl.display, config, native, attribs);
     }
@@ -770,13 +1003,24 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
     if (window->context.egl.surface == EGL_NO_SURFACE)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "EGL: Failed to create window surface: %s",
+                        "EGL: Failed to create surface: %s",
                         getEGLErrorString(eglGetError()));
         return GLFW_FALSE;
     }
 
     window->context.egl.config = config;
 
+    // NOTE: Wayland provides its own presentation feedback for the surface
+    if (_glfw.egl.ANDROID_get_frame_timestamps &&
+        _glfw.platform.platformID != GLFW_PLATFORM_WAYLAND &&
+        !window->offscreen)
+    {
+        window->context.egl.timestamps =
+            eglSurfaceAttrib(_glfw.egl.display,
+                             window->context.egl.surface,
+                             EGL_TIMESTAMPS_ANDROID, EGL_TRUE);
+    }
+
     // Load the appropriate client library
     if (!_glfw.egl.KHR_get_all_proc_addresses)
     {
@@ -862,12 +1106,37 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
         }
     }
 
+    // The initial swap interval of an EGL surface is one
+    window->context.interval = 1;
+
     window->context.makeCurrent = makeContextCurrentEGL;
     window->context.swapBuffers = swapBuffersEGL;
     window->context.swapInterval = swapIntervalEGL;
     window->context.extensionSupported = extensionSupportedEGL;
     window->context.getProcAddress = getProcAddressEGL;
     window->context.destroy = destroyContextEGL;
+    window->context.getFrameTimings = getFrameTimingsEGL;
+    window->context.swapBuffersWithDamage = swapBuffersWithDamageEGL;
+    window->context.getBufferAge = getBufferAgeEGL;
+
+#if defined(_GLFW_WAYLAND)
+    // NOTE: On Wayland the swap interval also selects the tearing presentation
+    //       hint, which must not change for a single swap
+    if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
+        window->context.skipSwapWait = skipSwapWaitEGL;
+#endif
+
+    // NOTE: Without EGL_KHR_get_all_proc_addresses, core functions are loaded
+    //       from the client library, which depends on the client API
+    if (_glfw.egl.KHR_get_all_proc_addresses ||
+        ctxconfig->client == GLFW_OPENGL_API)
+    {
+        window->context.procs = &_glfw.egl.procs[0];
+    }
+    else if (ctxconfig->major == 1)
+        window->context.procs = &_glfw.egl.procs[1];
+    else
+        window->context.procs = &_glfw.egl.procs[2];
 
     return GLFW_TRUE;
 }
@@ -888,7 +1157,7 @@ GLFWbool _glfwChooseVisualEGL(const _GLFWwndconfig* wndconfig,
     EGLint visualID = 0, count = 0;
     const long vimask = VisualScreenMask | VisualIDMask;
 
-    if (!chooseEGLConfig(ctxconfig, fbconfig, &native))
+    if (!chooseEGLConfig(ctxconfig, fbconfig, GLFW_FALSE, &native))
         return GLFW_FALSE;
 
     eglGetConfigAttrib(_glfw.egl.display, native,
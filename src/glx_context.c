@@ -47,15 +47,14 @@ static int getGLXFBConfigAttrib(GLXFBConfig fbconfig, int attrib)
     return value;
 }
 
-// Return the GLXFBConfig most closely matching the specified hints
+// Translates the RGBA GLXFBConfigs of the screen into the framebuffer
+// configuration cache
 //
-static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
-                                  GLXFBConfig* result)
+static GLFWbool loadGLXFBConfigs(void)
 {
     GLXFBConfig* nativeConfigs;
-    _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
-    int nativeCount, usableCount;
+    _GLFWfbconfigcache* cache = &_glfw.glx.fbconfigs;
+    int nativeCount;
     const char* vendor;
     GLFWbool trustWindowBit = GLFW_TRUE;
 
@@ -73,36 +72,28 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
         return GLFW_FALSE;
     }
 
-    usableConfigs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
-    usableCount = 0;
+    cache->configs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
+    cache->types = _glfw_calloc(nativeCount, sizeof(int));
+    cache->count = 0;
 
     for (int i = 0;  i < nativeCount;  i++)
     {
         const GLXFBConfig n = nativeConfigs[i];
-        _GLFWfbconfig* u = usableConfigs + usableCount;
+        _GLFWfbconfig* u = cache->configs + cache->count;
 
         // Only consider RGBA GLXFBConfigs
         if (!(getGLXFBConfigAttrib(n, GLX_RENDER_TYPE) & GLX_RGBA_BIT))
             continue;
 
-        // Only consider window GLXFBConfigs
-        if (!(getGLXFBConfigAttrib(n, GLX_DRAWABLE_TYPE) & GLX_WINDOW_BIT))
-        {
-            if (trustWindowBit)
-                continue;
-        }
-
-        if (getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER) != desired->doublebuffer)
-            continue;
+        cache->types[cache->count] = getGLXFBConfigAttrib(n, GLX_DRAWABLE_TYPE);
+        if (!trustWindowBit)
+            cache->types[cache->count] |= GLX_WINDOW_BIT;
 
-        if (desired->transparent)
+        XVisualInfo* vi = glXGetVisualFromFBConfig(_glfw.x11.display, n);
+        if (vi)
         {
-            XVisualInfo* vi = glXGetVisualFromFBConfig(_glfw.x11.display, n);
-            if (vi)
-            {
-                u->transparent = _glfwIsVisualTransparentX11(vi->visual);
-                XFree(vi);
-            }
+            u->transparent = _glfwIsVisualTransparentX11(vi->visual);
+            XFree(vi);
         }
 
         u->redBits = getGLXFBConfigAttrib(n, GLX_RED_SIZE);
@@ -120,6 +111,7 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
 
         u->auxBuffers = getGLXFBConfigAttrib(n, GLX_AUX_BUFFERS);
         u->stereo = getGLXFBConfigAttrib(n, GLX_STEREO);
+        u->doublebuffer = getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER);
 
         if (_glfw.glx.ARB_multisample)
             u->samples = getGLXFBConfigAttrib(n, GLX_SAMPLES);
@@ -128,14 +120,67 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
             u->sRGB = getGLXFBConfigAttrib(n, GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB);
 
         u->handle = (uintptr_t) n;
+        cache->count++;
+    }
+
+    XFree(nativeConfigs);
+    return GLFW_TRUE;
+}
+
+// Return the GLXFBConfig most closely matching the specified hints
+//
+static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
+                                  int drawableType,
+                                  GLXFBConfig* result)
+{
+    _GLFWfbconfigcache* cache = &_glfw.glx.fbconfigs;
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    int usableCount;
+    uintptr_t handle;
+
+    if (_glfwFindFBConfigChoice(cache, desired, drawableType, &handle))
+    {
+        *result = (GLXFBConfig) handle;
+        return GLFW_TRUE;
+    }
+
+    if (!cache->configs)
+    {
+        if (!loadGLXFBConfigs())
+            return GLFW_FALSE;
+    }
+
+    usableConfigs = _glfw_calloc(cache->count, sizeof(_GLFWfbconfig));
+    usableCount = 0;
+
+    for (int i = 0;  i < cache->count;  i++)
+    {
+        _GLFWfbconfig* u = usableConfigs + usableCount;
+
+        // Only consider GLXFBConfigs supporting the drawable type
+        if (!(cache->types[i] & drawableType))
+            continue;
+
+        if (cache->configs[i].doublebuffer != desired->doublebuffer)
+            continue;
+
+        *u = cache->configs[i];
+
+        // Only weigh transparency when it was requested
+        if (!desired->transparent)
+            u->transparent = GLFW_FALSE;
+
         usableCount++;
     }
 
     closest = _glfwChooseFBConfig(desired, usableConfigs, usableCount);
     if (closest)
+    {
         *result = (GLXFBConfig) closest->handle;
+        _glfwAddFBConfigChoice(cache, desired, drawableType, closest->handle);
+    }
 
-    XFree(nativeConfigs);
     _glfw_free(usableConfigs);
 
     return closest != NULL;
@@ -205,8 +250,76 @@ static void swapIntervalGLX(int interval)
     }
 }
 
+static int getBufferAgeGLX(_GLFWwindow* window)
+{
+    unsigned int age = 0;
+
+    if (!_glfw.glx.EXT_buffer_age)
+        return 0;
+
+    glXQueryDrawable(_glfw.x11.display,
+                     window->context.glx.window,
+                     GLX_BACK_BUFFER_AGE_EXT,
+                     &age);
+
+    return (int) age;
+}
+
+static GLFWbool getFrameTimingsGLX(_GLFWwindow* window)
+{
+    int64_t ust, msc, sbc;
+    int32_t numerator, denominator;
+    uint64_t vblankTime;
+
+    if (!_glfw.glx.OML_sync_control)
+        return GLFW_FALSE;
+
+    if (!_glfw.glx.GetSyncValuesOML(_glfw.x11.display,
+                                    window->context.glx.window,
+                                    &ust, &msc, &sbc))
+    {
+        return GLFW_FALSE;
+    }
+
+    // NOTE: The UST is in microseconds of the monotonic clock on Linux
+    if (ust <= 0 || !_glfwPlatformConvertMonotonicTime((uint64_t) ust * 1000,
+                                                       &vblankTime))
+    {
+        return GLFW_FALSE;
+    }
+
+    window->timings.vblankTime = vblankTime;
+
+    // NOTE: The swap counter only tells us that the swap completed at or before
+    //       the latest vblank, so use that vblank as the present time
+    if (sbc > window->context.glx.lastSbc)
+    {
+        window->context.glx.lastSbc = sbc;
+        window->timings.presentTime = vblankTime;
+
+        if ((uint64_t) sbc < window->timings.frame)
+            window->timings.presentedFrame = (uint64_t) sbc;
+        else
+            window->timings.presentedFrame = window->timings.frame;
+    }
+
+    if (_glfw.glx.GetMscRateOML(_glfw.x11.display,
+                                window->context.glx.window,
+                                &numerator, &denominator) &&
+        numerator > 0 && denominator > 0)
+    {
+        window->timings.refreshInterval =
+            _glfwPlatformGetTimerFrequency() * denominator / numerator;
+    }
+
+    return window->timings.presentedFrame != 0;
+}
+
 static int extensionSupportedGLX(const char* extension)
 {
+    if (_glfw.glx.extensions.offsets)
+        return _glfwExtensionInSet(&_glfw.glx.extensions, extension);
+
     const char* extensions =
         glXQueryExtensionsString(_glfw.x11.display, _glfw.x11.screen);
     if (extensions)
@@ -235,7 +348,11 @@ static void destroyContextGLX(_GLFWwindow* window)
 {
     if (window->context.glx.window)
     {
-        glXDestroyWindow(_glfw.x11.display, window->context.glx.window);
+        if (window->offscreen)
+            glXDestroyPbuffer(_glfw.x11.display, window->context.glx.window);
+        else
+            glXDestroyWindow(_glfw.x11.display, window->context.glx.window);
+
         window->context.glx.window = None;
     }
 
@@ -309,6 +426,12 @@ GLFWbool _glfwInitGLX(void)
         _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXCreateWindow");
     _glfw.glx.DestroyWindow = (PFNGLXDESTROYWINDOWPROC)
         _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXDestroyWindow");
+    _glfw.glx.CreatePbuffer = (PFNGLXCREATEPBUFFERPROC)
+        _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXCreatePbuffer");
+    _glfw.glx.DestroyPbuffer = (PFNGLXDESTROYPBUFFERPROC)
+        _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXDestroyPbuffer");
+    _glfw.glx.QueryDrawable = (PFNGLXQUERYDRAWABLEPROC)
+        _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXQueryDrawable");
     _glfw.glx.GetVisualFromFBConfig = (PFNGLXGETVISUALFROMFBCONFIGPROC)
         _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXGetVisualFromFBConfig");
 
@@ -324,6 +447,9 @@ GLFWbool _glfwInitGLX(void)
         !_glfw.glx.CreateNewContext ||
         !_glfw.glx.CreateWindow ||
         !_glfw.glx.DestroyWindow ||
+        !_glfw.glx.CreatePbuffer ||
+        !_glfw.glx.DestroyPbuffer ||
+        !_glfw.glx.QueryDrawable ||
         !_glfw.glx.GetVisualFromFBConfig)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
@@ -359,6 +485,11 @@ GLFWbool _glfwInitGLX(void)
         return GLFW_FALSE;
     }
 
+    const char* extensions =
+        glXQueryExtensionsString(_glfw.x11.display, _glfw.x11.screen);
+    if (extensions)
+        _glfwParseExtensionSet(&_glfw.glx.extensions, extensions);
+
     if (extensionSupportedGLX("GLX_EXT_swap_control"))
     {
         _glfw.glx.SwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC)
@@ -386,6 +517,20 @@ GLFWbool _glfwInitGLX(void)
             _glfw.glx.MESA_swap_control = true;
     }
 
+    if (extensionSupportedGLX("GLX_OML_sync_control"))
+    {
+        _glfw.glx.GetSyncValuesOML = (PFNGLXGETSYNCVALUESOMLPROC)
+            getProcAddressGLX("glXGetSyncValuesOML");
+        _glfw.glx.GetMscRateOML = (PFNGLXGETMSCRATEOMLPROC)
+            getProcAddressGLX("glXGetMscRateOML");
+
+        if (_glfw.glx.GetSyncValuesOML && _glfw.glx.GetMscRateOML)
+            _glfw.glx.OML_sync_control = true;
+    }
+
+    if (extensionSupportedGLX("GLX_EXT_buffer_age"))
+        _glfw.glx.EXT_buffer_age = true;
+
     if (extensionSupportedGLX("GLX_ARB_multisample"))
         _glfw.glx.ARB_multisample = true;
 
@@ -427,6 +572,10 @@ void _glfwTerminateGLX(void)
     // NOTE: This function must not call any X11 functions, as it is called
     //       after XCloseDisplay (see _glfwTerminateX11 for details)
 
+    _glfwFreeExtensionSet(&_glfw.glx.extensions);
+    _glfwFreeFBConfigCache(&_glfw.glx.fbconfigs);
+    _glfwFreeProcCache(&_glfw.glx.procs);
+
     _glfwPlatformFreeModule(_glfw.glx.handle);
     _glfw.glx.handle = NULL;
 }
@@ -443,13 +592,19 @@ GLFWbool _glfwCreateContextGLX(_GLFWwindow* window,
                                const _GLFWfbconfig* fbconfig)
 {
     int attribs[40];
+    int drawableType;
     GLXFBConfig native = NULL;
     GLXContext share = NULL;
 
     if (ctxconfig->share)
         share = ctxconfig->share->context.glx.handle;
 
-    if (!chooseGLXFBConfig(fbconfig, &native))
+    if (window->offscreen)
+        drawableType = GLX_PBUFFER_BIT;
+    else
+        drawableType = GLX_WINDOW_BIT;
+
+    if (!chooseGLXFBConfig(fbconfig, drawableType, &native))
     {
         _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
                         "GLX: Failed to find a suitable GLXFBConfig");
@@ -607,22 +762,48 @@ GLFWbool _glfwCreateContextGLX(_GLFWwindow* window,
         return GLFW_FALSE;
     }
 
-    window->context.glx.window =
-        glXCreateWindow(_glfw.x11.display, native, window->x11.handle, NULL);
-    if (!window->context.glx.window)
+    if (window->offscreen)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR, "GLX: Failed to create window");
-        return GLFW_FALSE;
+        const int pbufferAttribs[] =
+        {
+            GLX_PBUFFER_WIDTH, window->offscreenWidth,
+            GLX_PBUFFER_HEIGHT, window->offscreenHeight,
+            None
+        };
+
+        window->context.glx.window =
+            glXCreatePbuffer(_glfw.x11.display, native, pbufferAttribs);
+        if (!window->context.glx.window)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR, "GLX: Failed to create pbuffer");
+            return GLFW_FALSE;
+        }
+    }
+    else
+    {
+        window->context.glx.window =
+            glXCreateWindow(_glfw.x11.display, native, window->x11.handle, NULL);
+        if (!window->context.glx.window)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR, "GLX: Failed to create window");
+            return GLFW_FALSE;
+        }
     }
 
     window->context.glx.fbconfig = native;
 
+    // The initial swap interval of a GLX drawable is one
+    window->context.interval = 1;
+
     window->context.makeCurrent = makeContextCurrentGLX;
     window->context.swapBuffers = swapBuffersGLX;
     window->context.swapInterval = swapIntervalGLX;
     window->context.extensionSupported = extensionSupportedGLX;
     window->context.getProcAddress = getProcAddressGLX;
     window->context.destroy = destroyContextGLX;
+    window->context.getFrameTimings = getFrameTimingsGLX;
+    window->context.getBufferAge = getBufferAgeGLX;
+    window->context.procs = &_glfw.glx.procs;
 
     return GLFW_TRUE;
 }
@@ -639,7 +820,7 @@ GLFWbool _glfwChooseVisualGLX(const _GLFWwndconfig* wndconfig,
     GLXFBConfig native;
     XVisualInfo* result;
 
-    if (!chooseGLXFBConfig(fbconfig, &native))
+    if (!chooseGLXFBConfig(fbconfig, GLX_WINDOW_BIT, &native))
     {
         _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
                         "GLX: Failed to find a suitable GLXFBConfig");
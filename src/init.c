@@ -52,6 +52,7 @@ static _GLFWinitconfig _glfwInitHints =
     .hatButtons = true,
     .angleType = GLFW_ANGLE_PLATFORM_TYPE_NONE,
     .platformID = GLFW_ANY_PLATFORM,
+    .timerSource = GLFW_TIMER_SOURCE_DEFAULT,
     .vulkanLoader = NULL,
     .ns =
     {
@@ -97,6 +98,12 @@ static void terminate(void)
 
     memset(&_glfw.callbacks, 0, sizeof(_glfw.callbacks));
 
+    while (_glfw.contextPoolListHead)
+        glfwDestroyContextPool((GLFWcontextpool*) _glfw.contextPoolListHead);
+
+    while (_glfw.offscreenListHead)
+        glfwDestroyWindow((GLFWwindow*) _glfw.offscreenListHead);
+
     while (_glfw.windowListHead)
         glfwDestroyWindow((GLFWwindow*) _glfw.windowListHead);
 
@@ -135,6 +142,9 @@ static void terminate(void)
     _glfwPlatformDestroyTls(&_glfw.contextSlot);
     _glfwPlatformDestroyTls(&_glfw.errorSlot);
     _glfwPlatformDestroyMutex(&_glfw.errorLock);
+    _glfwPlatformDestroyMutex(&_glfw.windowLock);
+    _glfwPlatformDestroyMutex(&_glfw.procLock);
+    _glfwPlatformDestroyMutex(&_glfw.contextLock);
 
     memset(&_glfw, 0, sizeof(_glfw));
 }
@@ -299,6 +309,33 @@ void _glfw_free(void* block)
         _glfw.allocator.deallocate(block, _glfw.allocator.user);
 }
 
+// Returns whether the calling thread is the one that initialized the library
+//
+GLFWbool _glfwIsMainThread(void)
+{
+    // Only the main thread uses the statically allocated error slot
+    return _glfwPlatformGetTls(&_glfw.errorSlot) == &_glfwMainThreadError;
+}
+
+// Returns the error state of the calling thread, creating it if needed, which
+// also identifies the thread for as long as the library is initialized
+//
+_GLFWerror* _glfwGetThreadError(void)
+{
+    _GLFWerror* error = _glfwPlatformGetTls(&_glfw.errorSlot);
+    if (!error)
+    {
+        error = _glfw_calloc(1, sizeof(_GLFWerror));
+        _glfwPlatformSetTls(&_glfw.errorSlot, error);
+        _glfwPlatformLockMutex(&_glfw.errorLock);
+        error->next = _glfw.errorListHead;
+        _glfw.errorListHead = error;
+        _glfwPlatformUnlockMutex(&_glfw.errorLock);
+    }
+
+    return error;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
@@ -356,18 +393,7 @@ void _glfwInputError(int code, const char* format, ...)
     }
 
     if (_glfw.initialized)
-    {
-        error = _glfwPlatformGetTls(&_glfw.errorSlot);
-        if (!error)
-        {
-            error = _glfw_calloc(1, sizeof(_GLFWerror));
-            _glfwPlatformSetTls(&_glfw.errorSlot, error);
-            _glfwPlatformLockMutex(&_glfw.errorLock);
-            error->next = _glfw.errorListHead;
-            _glfw.errorListHead = error;
-            _glfwPlatformUnlockMutex(&_glfw.errorLock);
-        }
-    }
+        error = _glfwGetThreadError();
     else
         error = &_glfwMainThreadError;
 
@@ -409,6 +435,9 @@ GLFWAPI int glfwInit(void)
     }
 
     if (!_glfwPlatformCreateMutex(&_glfw.errorLock) ||
+        !_glfwPlatformCreateMutex(&_glfw.windowLock) ||
+        !_glfwPlatformCreateMutex(&_glfw.procLock) ||
+        !_glfwPlatformCreateMutex(&_glfw.contextLock) ||
         !_glfwPlatformCreateTls(&_glfw.errorSlot) ||
         !_glfwPlatformCreateTls(&_glfw.contextSlot))
     {
@@ -450,6 +479,20 @@ GLFWAPI void glfwInitHint(int hint, int value)
         case GLFW_PLATFORM:
             _glfwInitHints.platformID = value;
             return;
+        case GLFW_TIMER_SOURCE:
+        {
+            if (value != GLFW_TIMER_SOURCE_DEFAULT &&
+                value != GLFW_TIMER_SOURCE_MONOTONIC_RAW &&
+                value != GLFW_TIMER_SOURCE_TSC)
+            {
+                _glfwInputError(GLFW_INVALID_ENUM,
+                                "Invalid timer source 0x%08X", value);
+                return;
+            }
+
+            _glfwInitHints.timerSource = value;
+            return;
+        }
         case GLFW_COCOA_CHDIR_RESOURCES:
             _glfwInitHints.ns.chdir = value;
             return;
@@ -409,6 +409,20 @@ void _glfwInputDrop(_GLFWwindow* window, int count, const char** paths)
         window->callbacks.drop((GLFWwindow*) window, count, paths);
 }
 
+// Notifies shared code that a clipboard request has completed
+//
+void _glfwInputClipboardString(_GLFWwindow* window, const char* string)
+{
+    assert(window != NULL);
+
+    // The callback is cleared first so that it may make a new request
+    GLFWclipboardfun callback = window->clipboardRequest;
+    window->clipboardRequest = NULL;
+
+    if (callback)
+        callback((GLFWwindow*) window, string);
+}
+
 // Notifies shared code of a joystick connection or disconnection
 //
 void _glfwInputJoystick(_GLFWjoystick* js, int event)
@@ -1484,6 +1498,18 @@ GLFWAPI const char* glfwGetClipboardString(GLFWwindow* handle)
     return _glfw.platform.getClipboardString();
 }
 
+GLFWAPI void glfwRequestClipboardString(GLFWwindow* handle, GLFWclipboardfun callback)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(callback != NULL);
+
+    _GLFW_REQUIRE_INIT();
+
+    window->clipboardRequest = callback;
+    _glfw.platform.requestClipboardString(window);
+}
+
 GLFWAPI double glfwGetTime(void)
 {
     _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
@@ -1491,6 +1517,20 @@ GLFWAPI double glfwGetTime(void)
         _glfwPlatformGetTimerFrequency();
 }
 
+GLFWAPI uint64_t glfwGetTimeNs(void)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    const uint64_t value = _glfwPlatformGetTimerValue() - _glfw.timer.offset;
+    const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+
+    if (frequency == 1000000000)
+        return value;
+
+    return value / frequency * 1000000000 +
+        value % frequency * 1000000000 / frequency;
+}
+
 GLFWAPI void glfwSetTime(double time)
 {
     _GLFW_REQUIRE_INIT();
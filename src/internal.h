@@ -60,6 +60,9 @@
 
 #define _GLFW_MESSAGE_SIZE      1024
 
+// Number of framebuffer readbacks that may be in flight at once
+#define _GLFW_READBACK_SLOTS    3
+
 typedef int GLFWbool;
 typedef void (*GLFWproc)(void);
 
@@ -74,6 +77,7 @@ typedef struct _GLFWplatform    _GLFWplatform;
 typedef struct _GLFWlibrary     _GLFWlibrary;
 typedef struct _GLFWmonitor     _GLFWmonitor;
 typedef struct _GLFWcursor      _GLFWcursor;
+typedef struct _GLFWcontextpool _GLFWcontextpool;
 typedef struct _GLFWmapelement  _GLFWmapelement;
 typedef struct _GLFWmapping     _GLFWmapping;
 typedef struct _GLFWjoystick    _GLFWjoystick;
@@ -84,6 +88,8 @@ typedef struct _GLFWmutex       _GLFWmutex;
 #define GL_NONE 0
 #define GL_COLOR_BUFFER_BIT 0x00004000
 #define GL_UNSIGNED_BYTE 0x1401
+#define GL_UNSIGNED_SHORT 0x1403
+#define GL_FLOAT 0x1406
 #define GL_EXTENSIONS 0x1f03
 #define GL_NUM_EXTENSIONS 0x821d
 #define GL_CONTEXT_FLAGS 0x821e
@@ -98,18 +104,49 @@ typedef struct _GLFWmutex       _GLFWmutex;
 #define GL_CONTEXT_RELEASE_BEHAVIOR 0x82fb
 #define GL_CONTEXT_RELEASE_BEHAVIOR_FLUSH 0x82fc
 #define GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR 0x00000008
+#define GL_RGBA 0x1908
+#define GL_PACK_ROW_LENGTH 0x0d02
+#define GL_PACK_SKIP_ROWS 0x0d03
+#define GL_PACK_SKIP_PIXELS 0x0d04
+#define GL_PACK_ALIGNMENT 0x0d05
+#define GL_PIXEL_PACK_BUFFER 0x88eb
+#define GL_PIXEL_PACK_BUFFER_BINDING 0x88ed
+#define GL_STREAM_READ 0x88e1
+#define GL_MAP_READ_BIT 0x0001
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_TIMEOUT_EXPIRED 0x911b
+#define GL_WAIT_FAILED 0x911d
 
 typedef int GLint;
 typedef unsigned int GLuint;
 typedef unsigned int GLenum;
 typedef unsigned int GLbitfield;
 typedef unsigned char GLubyte;
+typedef unsigned char GLboolean;
+typedef int GLsizei;
+typedef ptrdiff_t GLintptr;
+typedef ptrdiff_t GLsizeiptr;
+typedef uint64_t GLuint64;
+typedef struct __GLsync* GLsync;
 
 typedef void (APIENTRY * PFNGLCLEARPROC)(GLbitfield);
 typedef const GLubyte* (APIENTRY * PFNGLGETSTRINGPROC)(GLenum);
 typedef void (APIENTRY * PFNGLGETINTEGERVPROC)(GLenum,GLint*);
 typedef const GLubyte* (APIENTRY * PFNGLGETSTRINGIPROC)(GLenum,GLuint);
 typedef void (APIENTRY * PFNGLFLUSHPROC)(void);
+typedef void (APIENTRY * PFNGLFINISHPROC)(void);
+typedef void (APIENTRY * PFNGLPIXELSTOREIPROC)(GLenum,GLint);
+typedef void (APIENTRY * PFNGLREADPIXELSPROC)(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,void*);
+typedef void (APIENTRY * PFNGLGENBUFFERSPROC)(GLsizei,GLuint*);
+typedef void (APIENTRY * PFNGLDELETEBUFFERSPROC)(GLsizei,const GLuint*);
+typedef void (APIENTRY * PFNGLBINDBUFFERPROC)(GLenum,GLuint);
+typedef void (APIENTRY * PFNGLBUFFERDATAPROC)(GLenum,GLsizeiptr,const void*,GLenum);
+typedef void* (APIENTRY * PFNGLMAPBUFFERRANGEPROC)(GLenum,GLintptr,GLsizeiptr,GLbitfield);
+typedef GLboolean (APIENTRY * PFNGLUNMAPBUFFERPROC)(GLenum);
+typedef GLsync (APIENTRY * PFNGLFENCESYNCPROC)(GLenum,GLbitfield);
+typedef GLenum (APIENTRY * PFNGLCLIENTWAITSYNCPROC)(GLsync,GLbitfield,GLuint64);
+typedef void (APIENTRY * PFNGLDELETESYNCPROC)(GLsync);
 
 #define EGL_SUCCESS 0x3000
 #define EGL_NOT_INITIALIZED 0x3001
@@ -144,6 +181,7 @@ typedef void (APIENTRY * PFNGLFLUSHPROC)(void);
 #define EGL_OPENGL_ES_API 0x30a0
 #define EGL_OPENGL_API 0x30a2
 #define EGL_NONE 0x3038
+#define EGL_TRUE 1
 #define EGL_RENDER_BUFFER 0x3086
 #define EGL_SINGLE_BUFFER 0x3085
 #define EGL_EXTENSIONS 0x3055
@@ -178,6 +216,12 @@ typedef void (APIENTRY * PFNGLFLUSHPROC)(void);
 #define EGL_PLATFORM_X11_EXT 0x31d5
 #define EGL_PLATFORM_WAYLAND_EXT 0x31d8
 #define EGL_PRESENT_OPAQUE_EXT 0x31df
+#define EGL_BUFFER_AGE_EXT 0x313d
+#define EGL_TIMESTAMPS_ANDROID 0x3430
+#define EGL_COMPOSITE_INTERVAL_ANDROID 0x3432
+#define EGL_DISPLAY_PRESENT_TIME_ANDROID 0x343a
+#define EGL_TIMESTAMP_PENDING_ANDROID ((EGLnsecsANDROID) -2)
+#define EGL_TIMESTAMP_INVALID_ANDROID ((EGLnsecsANDROID) -1)
 #define EGL_PLATFORM_ANGLE_ANGLE 0x3202
 #define EGL_PLATFORM_ANGLE_TYPE_ANGLE 0x3203
 #define EGL_PLATFORM_ANGLE_TYPE_OPENGL_ANGLE 0x320d
@@ -200,6 +244,9 @@ typedef void* EGLSurface;
 typedef void* EGLNativeDisplayType;
 typedef void* EGLNativeWindowType;
 
+typedef uint64_t EGLuint64KHR;
+typedef int64_t EGLnsecsANDROID;
+
 // EGL function pointer typedefs
 typedef EGLBoolean (APIENTRY * PFN_eglGetConfigAttrib)(EGLDisplay,EGLConfig,EGLint,EGLint*);
 typedef EGLBoolean (APIENTRY * PFN_eglGetConfigs)(EGLDisplay,EGLConfig*,EGLint,EGLint*);
@@ -218,6 +265,8 @@ typedef EGLBoolean (APIENTRY * PFN_eglSwapBuffers)(EGLDisplay,EGLSurface);
 typedef EGLBoolean (APIENTRY * PFN_eglSwapInterval)(EGLDisplay,EGLint);
 typedef const char* (APIENTRY * PFN_eglQueryString)(EGLDisplay,EGLint);
 typedef GLFWglproc (APIENTRY * PFN_eglGetProcAddress)(const char*);
+typedef EGLBoolean (APIENTRY * PFN_eglSurfaceAttrib)(EGLDisplay,EGLSurface,EGLint,EGLint);
+typedef EGLBoolean (APIENTRY * PFN_eglQuerySurface)(EGLDisplay,EGLSurface,EGLint,EGLint*);
 #define eglGetConfigAttrib _glfw.egl.GetConfigAttrib
 #define eglGetConfigs _glfw.egl.GetConfigs
 #define eglGetDisplay _glfw.egl.GetDisplay
@@ -235,13 +284,26 @@ typedef GLFWglproc (APIENTRY * PFN_eglGetProcAddress)(const char*);
 #define eglSwapInterval _glfw.egl.SwapInterval
 #define eglQueryString _glfw.egl.QueryString
 #define eglGetProcAddress _glfw.egl.GetProcAddress
+#define eglSurfaceAttrib _glfw.egl.SurfaceAttrib
+#define eglQuerySurface _glfw.egl.QuerySurface
 
 typedef EGLDisplay (APIENTRY * PFNEGLGETPLATFORMDISPLAYEXTPROC)(EGLenum,void*,const EGLint*);
 typedef EGLSurface (APIENTRY * PFNEGLCREATEPLATFORMWINDOWSURFACEEXTPROC)(EGLDisplay,EGLConfig,void*,const EGLint*);
 #define eglGetPlatformDisplayEXT _glfw.egl.GetPlatformDisplayEXT
 #define eglCreatePlatformWindowSurfaceEXT _glfw.egl.CreatePlatformWindowSurfaceEXT
 
+typedef EGLBoolean (APIENTRY * PFNEGLGETNEXTFRAMEIDANDROIDPROC)(EGLDisplay,EGLSurface,EGLuint64KHR*);
+typedef EGLBoolean (APIENTRY * PFNEGLGETCOMPOSITORTIMINGANDROIDPROC)(EGLDisplay,EGLSurface,EGLint,const EGLint*,EGLnsecsANDROID*);
+typedef EGLBoolean (APIENTRY * PFNEGLGETFRAMETIMESTAMPSANDROIDPROC)(EGLDisplay,EGLSurface,EGLuint64KHR,EGLint,const EGLint*,EGLnsecsANDROID*);
+#define eglGetNextFrameIdANDROID _glfw.egl.GetNextFrameIdANDROID
+#define eglGetCompositorTimingANDROID _glfw.egl.GetCompositorTimingANDROID
+#define eglGetFrameTimestampsANDROID _glfw.egl.GetFrameTimestampsANDROID
+
+typedef EGLBoolean (APIENTRY * PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)(EGLDisplay,EGLSurface,const EGLint*,EGLint);
+#define eglSwapBuffersWithDamageKHR _glfw.egl.SwapBuffersWithDamageKHR
+
 #define OSMESA_RGBA 0x1908
+#define OSMESA_BGRA 0x1
 #define OSMESA_FORMAT 0x22
 #define OSMESA_DEPTH_BITS 0x30
 #define OSMESA_STENCIL_BITS 0x31
@@ -332,6 +394,48 @@ typedef PFN_vkVoidFunction (APIENTRY * PFN_vkGetInstanceProcAddr)(VkInstance,con
 typedef VkResult (APIENTRY * PFN_vkEnumerateInstanceExtensionProperties)(const char*,uint32_t*,VkExtensionProperties*);
 #define vkGetInstanceProcAddr _glfw.vk.GetInstanceProcAddr
 
+// Hashed set of extension names, parsed once from an extension string
+//
+typedef struct _GLFWextensionset
+{
+    // Copies of the extension names, each terminated by a NUL
+    char*           names;
+    // The hash and one-based name offset of each slot, or zero if unused
+    uint32_t*       hashes;
+    uint32_t*       offsets;
+    uint32_t        mask;
+} _GLFWextensionset;
+
+// Hash table of resolved client API functions, shared by all contexts created
+// with the same context creation API and, where it matters, client API
+//
+typedef struct _GLFWproccache
+{
+    struct {
+        uint32_t    hash;
+        char*       name;
+        GLFWglproc  proc;
+    }*              entries;
+    uint32_t        mask;
+    uint32_t        count;
+} _GLFWproccache;
+
+// Framebuffer configurations of a display, translated once from the native
+// configurations, and the configurations previously chosen from them
+//
+typedef struct _GLFWfbconfigcache
+{
+    // The translated configurations and the native type bits of each
+    _GLFWfbconfig*  configs;
+    int*            types;
+    int             count;
+    // The requested configurations and required type bits of each previous
+    // choice, with the handle of the chosen configuration
+    _GLFWfbconfig*  choices;
+    int*            choiceTypes;
+    int             choiceCount;
+} _GLFWfbconfigcache;
+
 #include "platform.h"
 
 #define GLFW_NATIVE_INCLUDE_NONE
@@ -378,6 +482,7 @@ struct _GLFWinitconfig
     bool          hatButtons;
     int           angleType;
     int           platformID;
+    int           timerSource;
     PFN_vkGetInstanceProcAddr vulkanLoader;
     struct {
         bool      menubar;
@@ -415,6 +520,7 @@ struct _GLFWwndconfig
     bool          mousePassthrough;
     bool          scaleToMonitor;
     bool          scaleFramebuffer;
+    _GLFWwindow*  parent;
     struct {
         char      frameName[256];
     } ns;
@@ -428,6 +534,7 @@ struct _GLFWwndconfig
     } win32;
     struct {
         char      appId[256];
+        bool      allowTearing;
     } wl;
 };
 
@@ -453,6 +560,10 @@ struct _GLFWctxconfig
     struct {
         bool      offline;
     } nsgl;
+    struct {
+        int       format;
+        bool      doublebuffer;
+    } osmesa;
 };
 
 // Framebuffer configuration
@@ -495,31 +606,91 @@ struct _GLFWcontext
     int                 profile;
     int                 robustness;
     int                 release;
+    // The current swap interval, initially the default of the context API
+    int                 interval;
 
     PFNGLGETSTRINGIPROC  GetStringi;
     PFNGLGETINTEGERVPROC GetIntegerv;
     PFNGLGETSTRINGPROC   GetString;
     PFNGLFLUSHPROC       Flush;
 
+    _GLFWextensionset    extensions;
+    // The shared function cache of the context, guarded by the function cache
+    // lock, or NULL if lookups are not cached
+    _GLFWproccache*      procs;
+
     void (*makeCurrent)(_GLFWwindow*);
     void (*swapBuffers)(_GLFWwindow*);
     void (*swapInterval)(int);
     int (*extensionSupported)(const char*);
     GLFWglproc (*getProcAddress)(const char*);
     void (*destroy)(_GLFWwindow*);
+    // Optional, updates the presentation fields of the window frame timings
+    GLFWbool (*getFrameTimings)(_GLFWwindow*);
+    // Optional, swaps buffers with a list of damaged rectangles
+    void (*swapBuffersWithDamage)(_GLFWwindow*,const int*,int);
+    // Optional, returns the age of the back buffer
+    int (*getBufferAge)(_GLFWwindow*);
+    // Optional, makes the next buffer swap skip the swap interval wait
+    void (*skipSwapWait)(_GLFWwindow*);
+
+    // Framebuffer readback state, set up on first use
+    struct {
+        GLFWbool        initialized;
+        // Whether pixel buffer objects and fences are used
+        GLFWbool        async;
+        // The number of pixel pack parameters supported by the context
+        int             packParamCount;
+        struct {
+            GLuint      buffer;
+            GLsync      fence;
+            size_t      size;
+            int         width, height;
+        }               slots[_GLFW_READBACK_SLOTS];
+        // The slot to queue the next readback into and the number queued
+        int             next, pending;
+        // The slot mapped for the application, or -1 if none
+        int             mapped;
+        // Host memory for synchronous readback
+        unsigned char*  pixels;
+        size_t          size;
+
+        PFNGLFINISHPROC         Finish;
+        PFNGLPIXELSTOREIPROC    PixelStorei;
+        PFNGLREADPIXELSPROC     ReadPixels;
+        PFNGLGENBUFFERSPROC     GenBuffers;
+        PFNGLDELETEBUFFERSPROC  DeleteBuffers;
+        PFNGLBINDBUFFERPROC     BindBuffer;
+        PFNGLBUFFERDATAPROC     BufferData;
+        PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+        PFNGLUNMAPBUFFERPROC    UnmapBuffer;
+        PFNGLFENCESYNCPROC      FenceSync;
+        PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+        PFNGLDELETESYNCPROC     DeleteSync;
+    } readback;
 
     struct {
         EGLConfig       config;
         EGLContext      handle;
         EGLSurface      surface;
         void*           client;
+        GLFWbool        timestamps;
+        uint64_t        frameIds[4];
     } egl;
 
     struct {
         OSMesaContext   handle;
-        int             width;
-        int             height;
-        void*           buffer;
+        GLFWbool        doublebuffer;
+        GLenum          format;
+        GLenum          type;
+        int             bytesPerPixel;
+        // The buffers are only ever grown, so their capacities are tracked
+        // separately from the size of the image they currently hold
+        void*           buffers[2];
+        size_t          capacities[2];
+        int             widths[2];
+        int             heights[2];
+        int             back;
     } osmesa;
 
     // This is defined in platform.h
@@ -539,9 +710,27 @@ struct _GLFWwindow
     GLFWbool            floating;
     GLFWbool            focusOnShow;
     GLFWbool            mousePassthrough;
+    float               renderScale;
+    // The window this window is a layer of, if any, and the layers of this
+    // window, linked through their next layer pointers
+    _GLFWwindow*        parent;
+    _GLFWwindow*        layers;
+    _GLFWwindow*        nextLayer;
     GLFWbool            shouldClose;
     void*               userPointer;
     GLFWbool            doublebuffer;
+    // Whether this is a context without a window and the size of its surface
+    GLFWbool            offscreen;
+    int                 offscreenWidth, offscreenHeight;
+    // The pool owning this offscreen context and whether it is handed out
+    _GLFWcontextpool*   pool;
+    GLFWbool            acquired;
+    // The error state of the thread that acquired the pooled context
+    _GLFWerror*         acquirer;
+    // Frame rate limiter interval and next deadline, in raw timer units
+    uint64_t            frameInterval;
+    uint64_t            frameDeadline;
+    GLFWframetimings    timings;
     GLFWvidmode         videoMode;
     _GLFWmonitor*       monitor;
     _GLFWcursor*        cursor;
@@ -561,6 +750,8 @@ struct _GLFWwindow
     // Virtual cursor position when cursor is disabled
     double              virtualCursorPosX, virtualCursorPosY;
     GLFWbool            rawMouseMotion;
+    // Callback of the clipboard request in progress, if any
+    GLFWclipboardfun    clipboardRequest;
 
     _GLFWcontext        context;
 
@@ -678,6 +869,19 @@ struct _GLFWmutex
     GLFW_PLATFORM_MUTEX_STATE
 };
 
+// Pool of shared offscreen contexts
+//
+struct _GLFWcontextpool
+{
+    _GLFWcontextpool*   next;
+    _GLFWmutex          lock;
+    _GLFWwindow**       contexts;
+    int                 count;
+    // Stack of the contexts not currently acquired by a thread
+    _GLFWwindow**       available;
+    int                 availableCount;
+};
+
 // Platform API structure
 //
 struct _GLFWplatform
@@ -717,6 +921,7 @@ struct _GLFWplatform
     // window
     GLFWbool (*createWindow)(_GLFWwindow*,const _GLFWwndconfig*,const _GLFWctxconfig*,const _GLFWfbconfig*);
     void (*destroyWindow)(_GLFWwindow*);
+    GLFWbool (*createOffscreenContext)(_GLFWwindow*,const _GLFWctxconfig*,const _GLFWfbconfig*);
     void (*setWindowTitle)(_GLFWwindow*,const char*);
     void (*setWindowIcon)(_GLFWwindow*,int,const GLFWimage*);
     void (*getWindowPos)(_GLFWwindow*,int*,int*);
@@ -748,9 +953,13 @@ struct _GLFWplatform
     void (*setWindowFloating)(_GLFWwindow*,GLFWbool);
     void (*setWindowOpacity)(_GLFWwindow*,float);
     void (*setWindowMousePassthrough)(_GLFWwindow*,GLFWbool);
+    unsigned char* (*getWindowPixelBuffer)(_GLFWwindow*,int*,int*,int*);
+    void (*presentPixelBuffer)(_GLFWwindow*,const int*,int);
+    GLFWbool (*setWindowRenderScale)(_GLFWwindow*,float);
+    void (*requestClipboardString)(_GLFWwindow*);
     void (*pollEvents)(void);
     void (*waitEvents)(void);
-    void (*waitEventsTimeout)(double);
+    void (*waitEventsUntil)(uint64_t);
     void (*postEmptyEvent)(void);
     // EGL
     EGLenum (*getEGLPlatform)(EGLint**);
@@ -782,6 +991,8 @@ struct _GLFWlibrary
     _GLFWerror*         errorListHead;
     _GLFWcursor*        cursorListHead;
     _GLFWwindow*        windowListHead;
+    _GLFWwindow*        offscreenListHead;
+    _GLFWcontextpool*   contextPoolListHead;
 
     _GLFWmonitor**      monitors;
     int                 monitorCount;
@@ -794,6 +1005,10 @@ struct _GLFWlibrary
     _GLFWtls            errorSlot;
     _GLFWtls            contextSlot;
     _GLFWmutex          errorLock;
+    _GLFWmutex          windowLock;
+    _GLFWmutex          procLock;
+    // Serializes lazy loading of context APIs by threads creating windows
+    _GLFWmutex          contextLock;
 
     struct {
         uint64_t        offset;
@@ -806,6 +1021,11 @@ struct _GLFWlibrary
         EGLDisplay      display;
         EGLint          major, minor;
         GLFWbool        prefix;
+        _GLFWextensionset extensions;
+        _GLFWfbconfigcache fbconfigs;
+        // One cache for each client library, as without
+        // EGL_KHR_get_all_proc_addresses core functions are loaded from it
+        _GLFWproccache  procs[3];
 
         bool            KHR_create_context;
         bool            KHR_create_context_no_error;
@@ -817,6 +1037,9 @@ struct _GLFWlibrary
         bool            EXT_platform_x11;
         bool            EXT_platform_wayland;
         bool            EXT_present_opaque;
+        bool            ANDROID_get_frame_timestamps;
+        bool            KHR_swap_buffers_with_damage;
+        bool            EXT_buffer_age;
         bool            ANGLE_platform_angle;
         bool            ANGLE_platform_angle_opengl;
         bool            ANGLE_platform_angle_d3d;
@@ -843,9 +1066,16 @@ struct _GLFWlibrary
         PFN_eglSwapInterval         SwapInterval;
         PFN_eglQueryString          QueryString;
         PFN_eglGetProcAddress       GetProcAddress;
+        PFN_eglSurfaceAttrib        SurfaceAttrib;
+        PFN_eglQuerySurface         QuerySurface;
 
         PFNEGLGETPLATFORMDISPLAYEXTPROC GetPlatformDisplayEXT;
         PFNEGLCREATEPLATFORMWINDOWSURFACEEXTPROC CreatePlatformWindowSurfaceEXT;
+        PFNEGLGETNEXTFRAMEIDANDROIDPROC GetNextFrameIdANDROID;
+        PFNEGLGETCOMPOSITORTIMINGANDROIDPROC GetCompositorTimingANDROID;
+        PFNEGLGETFRAMETIMESTAMPSANDROIDPROC GetFrameTimestampsANDROID;
+        // Either the KHR or the EXT variant, which have identical signatures
+        PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC SwapBuffersWithDamageKHR;
     } egl;
 
     struct {
@@ -858,7 +1088,9 @@ struct _GLFWlibrary
         PFN_OSMesaGetColorBuffer        GetColorBuffer;
         PFN_OSMesaGetDepthBuffer        GetDepthBuffer;
         PFN_OSMesaGetProcAddress        GetProcAddress;
+        PFNGLFINISHPROC                 Finish;
 
+        _GLFWproccache  procs;
     } osmesa;
 
     struct {
@@ -899,6 +1131,8 @@ extern _GLFWlibrary _glfw;
 void _glfwPlatformInitTimer(void);
 uint64_t _glfwPlatformGetTimerValue(void);
 uint64_t _glfwPlatformGetTimerFrequency(void);
+void _glfwPlatformSleepUntil(uint64_t deadline);
+GLFWbool _glfwPlatformConvertMonotonicTime(uint64_t nanoseconds, uint64_t* value);
 
 GLFWbool _glfwPlatformCreateTls(_GLFWtls* tls);
 void _glfwPlatformDestroyTls(_GLFWtls* tls);
@@ -940,6 +1174,7 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
 void _glfwInputCursorPos(_GLFWwindow* window, double xpos, double ypos);
 void _glfwInputCursorEnter(_GLFWwindow* window, GLFWbool entered);
 void _glfwInputDrop(_GLFWwindow* window, int count, const char** names);
+void _glfwInputClipboardString(_GLFWwindow* window, const char* string);
 void _glfwInputJoystick(_GLFWjoystick* js, int event);
 void _glfwInputJoystickAxis(_GLFWjoystick* js, int axis, float value);
 void _glfwInputJoystickButton(_GLFWjoystick* js, int button, char value);
@@ -963,6 +1198,20 @@ void _glfwInputError(int code, const char* format, ...);
 GLFWbool _glfwSelectPlatform(int platformID, _GLFWplatform* platform);
 
 GLFWbool _glfwStringInExtensionString(const char* string, const char* extensions);
+GLFWbool _glfwParseExtensionSet(_GLFWextensionset* set, const char* extensions);
+GLFWbool _glfwExtensionInSet(const _GLFWextensionset* set, const char* extension);
+void _glfwFreeExtensionSet(_GLFWextensionset* set);
+void _glfwFreeProcCache(_GLFWproccache* cache);
+GLFWbool _glfwFindFBConfigChoice(const _GLFWfbconfigcache* cache,
+                                 const _GLFWfbconfig* desired,
+                                 int types,
+                                 uintptr_t* handle);
+void _glfwAddFBConfigChoice(_GLFWfbconfigcache* cache,
+                            const _GLFWfbconfig* desired,
+                            int types,
+                            uintptr_t handle);
+void _glfwFreeFBConfigCache(_GLFWfbconfigcache* cache);
+void _glfwDestroyReadback(_GLFWwindow* window);
 const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
                                          const _GLFWfbconfig* alternatives,
                                          unsigned int count);
@@ -1021,3 +1270,6 @@ void* _glfw_calloc(size_t count, size_t size);
 void* _glfw_realloc(void* pointer, size_t size);
 void _glfw_free(void* pointer);
 
+GLFWbool _glfwIsMainThread(void);
+_GLFWerror* _glfwGetThreadError(void);
+
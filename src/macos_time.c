@@ -53,5 +53,15 @@ uint64_t _glfwPlatformGetTimerFrequency(void)
     return _glfw.timer.macos.frequency;
 }
 
+void _glfwPlatformSleepUntil(uint64_t deadline)
+{
+    mach_wait_until(deadline);
+}
+
+GLFWbool _glfwPlatformConvertMonotonicTime(uint64_t nanoseconds, uint64_t* value)
+{
+    return GLFW_FALSE;
+}
+
 #endif // GLFW_BUILD_MACOS_TIMER
 
@@ -147,6 +147,7 @@ GLFWbool _glfwInitNSGL(void)
 
 void _glfwTerminateNSGL(void)
 {
+    _glfwFreeProcCache(&_glfw.nsgl.procs);
 }
 
 GLFWbool _glfwCreateContextNSGL(_GLFWwindow* window,
@@ -336,12 +337,18 @@ GLFWbool _glfwCreateContextNSGL(_GLFWwindow* window,
 
     [window->context.nsgl.object setView:window->ns.view];
 
+    GLint interval = 0;
+    [window->context.nsgl.object getValues:&interval
+                              forParameter:NSOpenGLContextParameterSwapInterval];
+    window->context.interval = interval;
+
     window->context.makeCurrent = makeContextCurrentNSGL;
     window->context.swapBuffers = swapBuffersNSGL;
     window->context.swapInterval = swapIntervalNSGL;
     window->context.extensionSupported = extensionSupportedNSGL;
     window->context.getProcAddress = getProcAddressNSGL;
     window->context.destroy = destroyContextNSGL;
+    window->context.procs = &_glfw.nsgl.procs;
 
     return GLFW_TRUE;
 }
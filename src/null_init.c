@@ -70,6 +70,7 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampNull,
         .createWindow = _glfwCreateWindowNull,
         .destroyWindow = _glfwDestroyWindowNull,
+        .createOffscreenContext = _glfwCreateOffscreenContextNull,
         .setWindowTitle = _glfwSetWindowTitleNull,
         .setWindowIcon = _glfwSetWindowIconNull,
         .getWindowPos = _glfwGetWindowPosNull,
@@ -101,9 +102,13 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingNull,
         .setWindowOpacity = _glfwSetWindowOpacityNull,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughNull,
+        .getWindowPixelBuffer = _glfwGetWindowPixelBufferNull,
+        .presentPixelBuffer = _glfwPresentPixelBufferNull,
+        .setWindowRenderScale = _glfwSetWindowRenderScaleNull,
+        .requestClipboardString = _glfwRequestClipboardStringNull,
         .pollEvents = _glfwPollEventsNull,
         .waitEvents = _glfwWaitEventsNull,
-        .waitEventsTimeout = _glfwWaitEventsTimeoutNull,
+        .waitEventsUntil = _glfwWaitEventsUntilNull,
         .postEmptyEvent = _glfwPostEmptyEventNull,
         .getEGLPlatform = _glfwGetEGLPlatformNull,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayNull,
@@ -183,6 +183,12 @@ typedef struct _GLFWwindowNull
     GLFWbool        floating;
     GLFWbool        transparent;
     float           opacity;
+    float           renderScale;
+    // Backing memory for the window pixel buffer, which is never shown
+    struct {
+        unsigned char*  data;
+        size_t          size;
+    } pixels;
 } _GLFWwindowNull;
 
 // Null-specific per-monitor data
@@ -200,6 +206,8 @@ typedef struct _GLFWlibraryNull
     int             ycursor;
     char*           clipboardString;
     _GLFWwindow*    focusedWindow;
+    // The window whose focus loss is being delivered on the main thread
+    _GLFWwindow*    unfocusingWindow;
     uint16_t        keycodes[GLFW_NULL_SC_LAST + 1];
     uint8_t         scancodes[GLFW_KEY_LAST + 1];
 } _GLFWlibraryNull;
@@ -221,6 +229,8 @@ void _glfwSetGammaRampNull(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
 
 GLFWbool _glfwCreateWindowNull(_GLFWwindow* window, const _GLFWwndconfig* wndconfig, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwDestroyWindowNull(_GLFWwindow* window);
+void _glfwReleaseWindowFocusNull(_GLFWwindow* window);
+GLFWbool _glfwCreateOffscreenContextNull(_GLFWwindow* window, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwSetWindowTitleNull(_GLFWwindow* window, const char* title);
 void _glfwSetWindowIconNull(_GLFWwindow* window, int count, const GLFWimage* images);
 void _glfwSetWindowMonitorNull(_GLFWwindow* window, _GLFWmonitor* monitor, int xpos, int ypos, int width, int height, int refreshRate);
@@ -243,6 +253,9 @@ void _glfwSetWindowResizableNull(_GLFWwindow* window, GLFWbool enabled);
 void _glfwSetWindowDecoratedNull(_GLFWwindow* window, GLFWbool enabled);
 void _glfwSetWindowFloatingNull(_GLFWwindow* window, GLFWbool enabled);
 void _glfwSetWindowMousePassthroughNull(_GLFWwindow* window, GLFWbool enabled);
+unsigned char* _glfwGetWindowPixelBufferNull(_GLFWwindow* window, int* width, int* height, int* stride);
+void _glfwPresentPixelBufferNull(_GLFWwindow* window, const int* rects, int count);
+GLFWbool _glfwSetWindowRenderScaleNull(_GLFWwindow* window, float scale);
 float _glfwGetWindowOpacityNull(_GLFWwindow* window);
 void _glfwSetWindowOpacityNull(_GLFWwindow* window, float opacity);
 void _glfwSetRawMouseMotionNull(_GLFWwindow *window, GLFWbool enabled);
@@ -256,7 +269,7 @@ GLFWbool _glfwWindowIconifiedNull(_GLFWwindow* window);
 GLFWbool _glfwWindowVisibleNull(_GLFWwindow* window);
 void _glfwPollEventsNull(void);
 void _glfwWaitEventsNull(void);
-void _glfwWaitEventsTimeoutNull(double timeout);
+void _glfwWaitEventsUntilNull(uint64_t deadline);
 void _glfwPostEmptyEventNull(void);
 void _glfwGetCursorPosNull(_GLFWwindow* window, double* xpos, double* ypos);
 void _glfwSetCursorPosNull(_GLFWwindow* window, double x, double y);
@@ -267,6 +280,7 @@ void _glfwDestroyCursorNull(_GLFWcursor* cursor);
 void _glfwSetCursorNull(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringNull(const char* string);
 const char* _glfwGetClipboardStringNull(void);
+void _glfwRequestClipboardStringNull(_GLFWwindow* window);
 const char* _glfwGetScancodeNameNull(int scancode);
 int _glfwGetKeyScancodeNull(int key);
 
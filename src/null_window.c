@@ -49,6 +49,11 @@ static void applySizeLimits(_GLFWwindow* window, int* width, int* height)
         *height = _glfw_max(*height, window->maxheight);
 }
 
+static int scaleRenderSize(_GLFWwindow* window, int size)
+{
+    return _glfw_max((int) (size * window->null.renderScale + 0.5f), 1);
+}
+
 static void fitToMonitor(_GLFWwindow* window)
 {
     GLFWvidmode mode;
@@ -102,10 +107,100 @@ static int createNativeWindow(_GLFWwindow* window,
     window->null.floating = wndconfig->floating;
     window->null.transparent = fbconfig->transparent;
     window->null.opacity = 1.f;
+    window->null.renderScale = 1.f;
 
     return GLFW_TRUE;
 }
 
+// Clears the focused window if it is the specified window and returns whether
+// it was, as windows may be destroyed on any thread
+//
+static GLFWbool releaseFocus(_GLFWwindow* window)
+{
+    GLFWbool focused = GLFW_FALSE;
+
+    _glfwPlatformLockMutex(&_glfw.windowLock);
+
+    if (_glfw.null.focusedWindow == window)
+    {
+        _glfw.null.focusedWindow = NULL;
+        focused = GLFW_TRUE;
+    }
+
+    _glfwPlatformUnlockMutex(&_glfw.windowLock);
+    return focused;
+}
+
+// Waits until the main thread has delivered the focus loss of the specified
+// window, so that the window is not freed while it is still being used
+//
+static void waitForFocusLoss(_GLFWwindow* window)
+{
+    for (;;)
+    {
+        _glfwPlatformLockMutex(&_glfw.windowLock);
+        const GLFWbool unfocusing = _glfw.null.unfocusingWindow == window;
+        _glfwPlatformUnlockMutex(&_glfw.windowLock);
+
+        if (!unfocusing)
+            break;
+
+        _glfwPlatformSleepUntil(_glfwPlatformGetTimerValue() +
+                                _glfwPlatformGetTimerFrequency() / 1000);
+    }
+}
+
+// Creates the context of a window or offscreen context
+//
+static GLFWbool createContext(_GLFWwindow* window,
+                              const _GLFWctxconfig* ctxconfig,
+                              const _GLFWfbconfig* fbconfig)
+{
+    GLFWbool result = GLFW_TRUE;
+
+    // NOTE: Windows may be created on any thread on this platform, so lazy
+    //       loading of the context API is serialized, as is the EGL config
+    //       cache used while choosing a config, without blocking the window
+    //       list for other threads
+    if (ctxconfig->source == GLFW_NATIVE_CONTEXT_API ||
+        ctxconfig->source == GLFW_OSMESA_CONTEXT_API)
+    {
+        _glfwPlatformLockMutex(&_glfw.contextLock);
+        result = _glfwInitOSMesa();
+        _glfwPlatformUnlockMutex(&_glfw.contextLock);
+
+        if (result)
+            result = _glfwCreateContextOSMesa(window, ctxconfig, fbconfig);
+    }
+    else if (ctxconfig->source == GLFW_EGL_CONTEXT_API)
+    {
+        _glfwPlatformLockMutex(&_glfw.contextLock);
+        result = _glfwInitEGL() &&
+                 _glfwCreateContextEGL(window, ctxconfig, fbconfig);
+        _glfwPlatformUnlockMutex(&_glfw.contextLock);
+    }
+
+    return result;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Removes focus from a window that is being destroyed, before its callbacks are
+// cleared, as the main thread may be delivering its focus loss
+//
+void _glfwReleaseWindowFocusNull(_GLFWwindow* window)
+{
+    releaseFocus(window);
+
+    // NOTE: Focus events are only delivered on the main thread, which never
+    //       destroys a window from inside a callback
+    if (!_glfwIsMainThread())
+        waitForFocusLoss(window);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -121,21 +216,8 @@ GLFWbool _glfwCreateWindowNull(_GLFWwindow* window,
 
     if (ctxconfig->client != GLFW_NO_API)
     {
-        if (ctxconfig->source == GLFW_NATIVE_CONTEXT_API ||
-            ctxconfig->source == GLFW_OSMESA_CONTEXT_API)
-        {
-            if (!_glfwInitOSMesa())
-                return GLFW_FALSE;
-            if (!_glfwCreateContextOSMesa(window, ctxconfig, fbconfig))
-                return GLFW_FALSE;
-        }
-        else if (ctxconfig->source == GLFW_EGL_CONTEXT_API)
-        {
-            if (!_glfwInitEGL())
-                return GLFW_FALSE;
-            if (!_glfwCreateContextEGL(window, ctxconfig, fbconfig))
-                return GLFW_FALSE;
-        }
+        if (!createContext(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
 
         if (!_glfwRefreshContextAttribs(window, ctxconfig))
             return GLFW_FALSE;
@@ -144,10 +226,15 @@ GLFWbool _glfwCreateWindowNull(_GLFWwindow* window,
     if (wndconfig->mousePassthrough)
         _glfwSetWindowMousePassthroughNull(window, GLFW_TRUE);
 
+    // NOTE: Focus callbacks may only be called on the main thread, so windows
+    //       created on other threads are not focused
+    const GLFWbool focus = _glfwIsMainThread();
+
     if (window->monitor)
     {
         _glfwShowWindowNull(window);
-        _glfwFocusWindowNull(window);
+        if (focus)
+            _glfwFocusWindowNull(window);
         acquireMonitor(window);
 
         if (wndconfig->centerCursor)
@@ -158,7 +245,7 @@ GLFWbool _glfwCreateWindowNull(_GLFWwindow* window,
         if (wndconfig->visible)
         {
             _glfwShowWindowNull(window);
-            if (wndconfig->focused)
+            if (wndconfig->focused && focus)
                 _glfwFocusWindowNull(window);
         }
     }
@@ -171,11 +258,17 @@ void _glfwDestroyWindowNull(_GLFWwindow* window)
     if (window->monitor)
         releaseMonitor(window);
 
-    if (_glfw.null.focusedWindow == window)
-        _glfw.null.focusedWindow = NULL;
-
     if (window->context.destroy)
         window->context.destroy(window);
+
+    _glfw_free(window->null.pixels.data);
+}
+
+GLFWbool _glfwCreateOffscreenContextNull(_GLFWwindow* window,
+                                         const _GLFWctxconfig* ctxconfig,
+                                         const _GLFWfbconfig* fbconfig)
+{
+    return createContext(window, ctxconfig, fbconfig);
 }
 
 void _glfwSetWindowTitleNull(_GLFWwindow* window, const char* title)
@@ -259,7 +352,9 @@ void _glfwSetWindowSizeNull(_GLFWwindow* window, int width, int height)
     {
         window->null.width = width;
         window->null.height = height;
-        _glfwInputFramebufferSize(window, width, height);
+        _glfwInputFramebufferSize(window,
+                                  scaleRenderSize(window, width),
+                                  scaleRenderSize(window, height));
         _glfwInputWindowDamage(window);
         _glfwInputWindowSize(window, width, height);
     }
@@ -286,9 +381,9 @@ void _glfwSetWindowAspectRatioNull(_GLFWwindow* window, int n, int d)
 void _glfwGetFramebufferSizeNull(_GLFWwindow* window, int* width, int* height)
 {
     if (width)
-        *width = window->null.width;
+        *width = scaleRenderSize(window, window->null.width);
     if (height)
-        *height = window->null.height;
+        *height = scaleRenderSize(window, window->null.height);
 }
 
 void _glfwGetWindowFrameSizeNull(_GLFWwindow* window,
@@ -329,11 +424,8 @@ void _glfwGetWindowContentScaleNull(_GLFWwindow* window, float* xscale, float* y
 
 void _glfwIconifyWindowNull(_GLFWwindow* window)
 {
-    if (_glfw.null.focusedWindow == window)
-    {
-        _glfw.null.focusedWindow = NULL;
+    if (releaseFocus(window))
         _glfwInputWindowFocus(window, GLFW_FALSE);
-    }
 
     if (!window->null.iconified)
     {
@@ -408,6 +500,44 @@ void _glfwSetWindowMousePassthroughNull(_GLFWwindow* window, GLFWbool enabled)
 {
 }
 
+unsigned char* _glfwGetWindowPixelBufferNull(_GLFWwindow* window,
+                                             int* width, int* height,
+                                             int* stride)
+{
+    const int bufferWidth = scaleRenderSize(window, window->null.width);
+    const int bufferHeight = scaleRenderSize(window, window->null.height);
+    const size_t size = (size_t) bufferWidth * bufferHeight * 4;
+
+    if (window->null.pixels.size < size)
+    {
+        unsigned char* data = _glfw_realloc(window->null.pixels.data, size);
+        if (!data)
+            return NULL;
+
+        window->null.pixels.data = data;
+        window->null.pixels.size = size;
+    }
+
+    *width = bufferWidth;
+    *height = bufferHeight;
+    *stride = bufferWidth * 4;
+    return window->null.pixels.data;
+}
+
+void _glfwPresentPixelBufferNull(_GLFWwindow* window, const int* rects, int count)
+{
+}
+
+GLFWbool _glfwSetWindowRenderScaleNull(_GLFWwindow* window, float scale)
+{
+    window->null.renderScale = scale;
+    _glfwInputFramebufferSize(window,
+                              scaleRenderSize(window, window->null.width),
+                              scaleRenderSize(window, window->null.height));
+    _glfwInputWindowDamage(window);
+    return GLFW_TRUE;
+}
+
 float _glfwGetWindowOpacityNull(_GLFWwindow* window)
 {
     return window->null.opacity;
@@ -438,11 +568,8 @@ void _glfwRequestWindowAttentionNull(_GLFWwindow* window)
 
 void _glfwHideWindowNull(_GLFWwindow* window)
 {
-    if (_glfw.null.focusedWindow == window)
-    {
-        _glfw.null.focusedWindow = NULL;
+    if (releaseFocus(window))
         _glfwInputWindowFocus(window, GLFW_FALSE);
-    }
 
     window->null.visible = GLFW_FALSE;
 }
@@ -451,20 +578,31 @@ void _glfwFocusWindowNull(_GLFWwindow* window)
 {
     _GLFWwindow* previous;
 
-    if (_glfw.null.focusedWindow == window)
-        return;
-
     if (!window->null.visible)
         return;
 
+    // NOTE: The previous window may be destroyed on another thread as soon as
+    //       it is no longer focused, so it is marked under the lock and its
+    //       destruction waits until its focus loss has been delivered
+    _glfwPlatformLockMutex(&_glfw.windowLock);
     previous = _glfw.null.focusedWindow;
     _glfw.null.focusedWindow = window;
+    if (previous != window)
+        _glfw.null.unfocusingWindow = previous;
+    _glfwPlatformUnlockMutex(&_glfw.windowLock);
+
+    if (previous == window)
+        return;
 
     if (previous)
     {
         _glfwInputWindowFocus(previous, GLFW_FALSE);
         if (previous->monitor && previous->autoIconify)
             _glfwIconifyWindowNull(previous);
+
+        _glfwPlatformLockMutex(&_glfw.windowLock);
+        _glfw.null.unfocusingWindow = NULL;
+        _glfwPlatformUnlockMutex(&_glfw.windowLock);
     }
 
     _glfwInputWindowFocus(window, GLFW_TRUE);
@@ -472,7 +610,10 @@ void _glfwFocusWindowNull(_GLFWwindow* window)
 
 GLFWbool _glfwWindowFocusedNull(_GLFWwindow* window)
 {
-    return _glfw.null.focusedWindow == window;
+    _glfwPlatformLockMutex(&_glfw.windowLock);
+    const GLFWbool focused = _glfw.null.focusedWindow == window;
+    _glfwPlatformUnlockMutex(&_glfw.windowLock);
+    return focused;
 }
 
 GLFWbool _glfwWindowIconifiedNull(_GLFWwindow* window)
@@ -493,7 +634,7 @@ void _glfwWaitEventsNull(void)
 {
 }
 
-void _glfwWaitEventsTimeoutNull(double timeout)
+void _glfwWaitEventsUntilNull(uint64_t deadline)
 {
 }
 
@@ -551,6 +692,17 @@ const char* _glfwGetClipboardStringNull(void)
     return _glfw.null.clipboardString;
 }
 
+void _glfwRequestClipboardStringNull(_GLFWwindow* window)
+{
+    if (!_glfw.null.clipboardString)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "Null: No clipboard data available");
+    }
+
+    _glfwInputClipboardString(window, _glfw.null.clipboardString);
+}
+
 EGLenum _glfwGetEGLPlatformNull(EGLint** attribs)
 {
     if (_glfw.egl.EXT_platform_base && _glfw.egl.MESA_platform_surfaceless)
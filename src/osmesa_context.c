@@ -31,35 +31,75 @@
 #include <string.h>
 #include <assert.h>
 
-static void makeContextCurrentOSMesa(_GLFWwindow* window)
+// Makes sure the specified color buffer can hold an image of the specified
+// size, growing it if necessary
+//
+static GLFWbool resizeColorBuffer(_GLFWwindow* window, int index,
+                                  int width, int height)
 {
-    if (window)
+    const size_t size = (size_t) width * height *
+                        window->context.osmesa.bytesPerPixel;
+
+    // NOTE: The buffer is never shrunk and the new area is never cleared, as
+    //       the contents of a resized framebuffer are undefined anyway
+    if (size > window->context.osmesa.capacities[index])
     {
-        int width, height;
+        void* buffer = _glfw_realloc(window->context.osmesa.buffers[index], size);
+        if (!buffer)
+            return GLFW_FALSE;
+
+        window->context.osmesa.buffers[index] = buffer;
+        window->context.osmesa.capacities[index] = size;
+    }
+
+    window->context.osmesa.widths[index] = width;
+    window->context.osmesa.heights[index] = height;
+    return GLFW_TRUE;
+}
+
+// Binds the current back buffer to the context, resizing it to match the
+// framebuffer if necessary
+//
+static GLFWbool bindBackBuffer(_GLFWwindow* window)
+{
+    const int back = window->context.osmesa.back;
+    int width, height;
+
+    if (window->offscreen)
+    {
+        width = window->offscreenWidth;
+        height = window->offscreenHeight;
+    }
+    else
         _glfw.platform.getFramebufferSize(window, &width, &height);
 
-        // Check to see if we need to allocate a new buffer
-        if ((window->context.osmesa.buffer == NULL) ||
-            (width != window->context.osmesa.width) ||
-            (height != window->context.osmesa.height))
-        {
-            _glfw_free(window->context.osmesa.buffer);
+    if (!window->context.osmesa.buffers[back] ||
+        width != window->context.osmesa.widths[back] ||
+        height != window->context.osmesa.heights[back])
+    {
+        if (!resizeColorBuffer(window, back, width, height))
+            return GLFW_FALSE;
+    }
 
-            // Allocate the new buffer (width * height * 8-bit RGBA)
-            window->context.osmesa.buffer = _glfw_calloc(4, (size_t) width * height);
-            window->context.osmesa.width  = width;
-            window->context.osmesa.height = height;
-        }
+    if (!OSMesaMakeCurrent(window->context.osmesa.handle,
+                           window->context.osmesa.buffers[back],
+                           window->context.osmesa.type,
+                           width, height))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "OSMesa: Failed to make context current");
+        return GLFW_FALSE;
+    }
 
-        if (!OSMesaMakeCurrent(window->context.osmesa.handle,
-                               window->context.osmesa.buffer,
-                               GL_UNSIGNED_BYTE,
-                               width, height))
-        {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "OSMesa: Failed to make context current");
+    return GLFW_TRUE;
+}
+
+static void makeContextCurrentOSMesa(_GLFWwindow* window)
+{
+    if (window)
+    {
+        if (!bindBackBuffer(window))
             return;
-        }
     }
 
     _glfwPlatformSetTls(&_glfw.contextSlot, window);
@@ -72,23 +112,44 @@ static GLFWglproc getProcAddressOSMesa(const char* procname)
 
 static void destroyContextOSMesa(_GLFWwindow* window)
 {
+    int i;
+
     if (window->context.osmesa.handle)
     {
         OSMesaDestroyContext(window->context.osmesa.handle);
         window->context.osmesa.handle = NULL;
     }
 
-    if (window->context.osmesa.buffer)
+    for (i = 0;  i < 2;  i++)
     {
-        _glfw_free(window->context.osmesa.buffer);
-        window->context.osmesa.width = 0;
-        window->context.osmesa.height = 0;
+        _glfw_free(window->context.osmesa.buffers[i]);
+        window->context.osmesa.buffers[i] = NULL;
+        window->context.osmesa.capacities[i] = 0;
+        window->context.osmesa.widths[i] = 0;
+        window->context.osmesa.heights[i] = 0;
     }
 }
 
 static void swapBuffersOSMesa(_GLFWwindow* window)
 {
-    // No double buffering on OSMesa
+    // Single buffered windows render directly into the only color buffer
+    if (!window->context.osmesa.doublebuffer)
+        return;
+
+    // NOTE: OSMesa can only change the color buffer of the current context
+    if (_glfwPlatformGetTls(&_glfw.contextSlot) != window)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "OSMesa: The context must be current on the calling thread to swap buffers");
+        return;
+    }
+
+    // The back buffer must be complete before it can be handed out as the
+    // front buffer
+    _glfw.osmesa.Finish();
+
+    window->context.osmesa.back ^= 1;
+    bindBackBuffer(window);
 }
 
 static void swapIntervalOSMesa(int interval)
@@ -161,12 +222,19 @@ GLFWbool _glfwInitOSMesa(void)
     _glfw.osmesa.GetProcAddress = (PFN_OSMesaGetProcAddress)
         _glfwPlatformGetModuleSymbol(_glfw.osmesa.handle, "OSMesaGetProcAddress");
 
+    if (_glfw.osmesa.GetProcAddress)
+    {
+        _glfw.osmesa.Finish = (PFNGLFINISHPROC)
+            OSMesaGetProcAddress("glFinish");
+    }
+
     if (!_glfw.osmesa.CreateContextExt ||
         !_glfw.osmesa.DestroyContext ||
         !_glfw.osmesa.MakeCurrent ||
         !_glfw.osmesa.GetColorBuffer ||
         !_glfw.osmesa.GetDepthBuffer ||
-        !_glfw.osmesa.GetProcAddress)
+        !_glfw.osmesa.GetProcAddress ||
+        !_glfw.osmesa.Finish)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "OSMesa: Failed to load required entry points");
@@ -180,6 +248,8 @@ GLFWbool _glfwInitOSMesa(void)
 
 void _glfwTerminateOSMesa(void)
 {
+    _glfwFreeProcCache(&_glfw.osmesa.procs);
+
     _glfwPlatformFreeModule(_glfw.osmesa.handle);
     _glfw.osmesa.handle = NULL;
 }
@@ -196,6 +266,8 @@ GLFWbool _glfwCreateContextOSMesa(_GLFWwindow* window,
                                   const _GLFWfbconfig* fbconfig)
 {
     OSMesaContext share = NULL;
+    GLenum format, type;
+    int bytesPerPixel;
     const int accumBits = fbconfig->accumRedBits +
                           fbconfig->accumGreenBits +
                           fbconfig->accumBlueBits +
@@ -208,6 +280,35 @@ GLFWbool _glfwCreateContextOSMesa(_GLFWwindow* window,
         return GLFW_FALSE;
     }
 
+    switch (ctxconfig->osmesa.format)
+    {
+        case GLFW_OSMESA_RGBA8:
+            format = OSMESA_RGBA;
+            type = GL_UNSIGNED_BYTE;
+            bytesPerPixel = 4;
+            break;
+        case GLFW_OSMESA_BGRA8:
+            format = OSMESA_BGRA;
+            type = GL_UNSIGNED_BYTE;
+            bytesPerPixel = 4;
+            break;
+        case GLFW_OSMESA_RGBA16:
+            format = OSMESA_RGBA;
+            type = GL_UNSIGNED_SHORT;
+            bytesPerPixel = 8;
+            break;
+        case GLFW_OSMESA_RGBA32F:
+            format = OSMESA_RGBA;
+            type = GL_FLOAT;
+            bytesPerPixel = 16;
+            break;
+        default:
+            _glfwInputError(GLFW_INVALID_ENUM,
+                            "OSMesa: Invalid pixel format 0x%08X",
+                            ctxconfig->osmesa.format);
+            return GLFW_FALSE;
+    }
+
     if (ctxconfig->share)
         share = ctxconfig->share->context.osmesa.handle;
 
@@ -215,7 +316,7 @@ GLFWbool _glfwCreateContextOSMesa(_GLFWwindow* window,
     {
         int index = 0, attribs[40];
 
-        SET_ATTRIB(OSMESA_FORMAT, OSMESA_RGBA);
+        SET_ATTRIB(OSMESA_FORMAT, format);
         SET_ATTRIB(OSMESA_DEPTH_BITS, fbconfig->depthBits);
         SET_ATTRIB(OSMESA_STENCIL_BITS, fbconfig->stencilBits);
         SET_ATTRIB(OSMESA_ACCUM_BITS, accumBits);
@@ -257,7 +358,7 @@ GLFWbool _glfwCreateContextOSMesa(_GLFWwindow* window,
         }
 
         window->context.osmesa.handle =
-            OSMesaCreateContextExt(OSMESA_RGBA,
+            OSMesaCreateContextExt(format,
                                    fbconfig->depthBits,
                                    fbconfig->stencilBits,
                                    accumBits,
@@ -271,12 +372,21 @@ GLFWbool _glfwCreateContextOSMesa(_GLFWwindow* window,
         return GLFW_FALSE;
     }
 
+    // Flipping color buffers changes what glfwGetOSMesaColorBuffer returns, so
+    // it is only done when explicitly requested
+    window->context.osmesa.doublebuffer =
+        ctxconfig->osmesa.doublebuffer && fbconfig->doublebuffer;
+    window->context.osmesa.format = format;
+    window->context.osmesa.type = type;
+    window->context.osmesa.bytesPerPixel = bytesPerPixel;
+
     window->context.makeCurrent = makeContextCurrentOSMesa;
     window->context.swapBuffers = swapBuffersOSMesa;
     window->context.swapInterval = swapIntervalOSMesa;
     window->context.extensionSupported = extensionSupportedOSMesa;
     window->context.getProcAddress = getProcAddressOSMesa;
     window->context.destroy = destroyContextOSMesa;
+    window->context.procs = &_glfw.osmesa.procs;
 
     return GLFW_TRUE;
 }
@@ -305,13 +415,34 @@ GLFWAPI int glfwGetOSMesaColorBuffer(GLFWwindow* handle, int* width,
         return GLFW_FALSE;
     }
 
-    if (!OSMesaGetColorBuffer(window->context.osmesa.handle,
-                              &mesaWidth, &mesaHeight,
-                              &mesaFormat, &mesaBuffer))
+    if (window->context.osmesa.doublebuffer)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "OSMesa: Failed to retrieve color buffer");
-        return GLFW_FALSE;
+        // The front buffer holds the most recently swapped frame and is not
+        // touched by rendering until the next swap
+        const int front = window->context.osmesa.back ^ 1;
+
+        mesaBuffer = window->context.osmesa.buffers[front];
+        mesaWidth = window->context.osmesa.widths[front];
+        mesaHeight = window->context.osmesa.heights[front];
+        mesaFormat = window->context.osmesa.format;
+
+        if (!mesaBuffer)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "OSMesa: No buffers have been swapped yet");
+            return GLFW_FALSE;
+        }
+    }
+    else
+    {
+        if (!OSMesaGetColorBuffer(window->context.osmesa.handle,
+                                  &mesaWidth, &mesaHeight,
+                                  &mesaFormat, &mesaBuffer))
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "OSMesa: Failed to retrieve color buffer");
+            return GLFW_FALSE;
+        }
     }
 
     if (width)
@@ -33,39 +33,45 @@
 #include <signal.h>
 #include <time.h>
 #include <errno.h>
+#include <limits.h>
 
-GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
+GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, const uint64_t* deadline)
 {
     for (;;)
     {
-        if (timeout)
+        if (deadline)
         {
-            const uint64_t base = _glfwPlatformGetTimerValue();
+            // The remaining time is recomputed from the absolute deadline on
+            // every iteration so that interrupted waits do not accumulate drift
+            const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+            const uint64_t now = _glfwPlatformGetTimerValue();
+            const uint64_t remaining = *deadline > now ? *deadline - now : 0;
 
-#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__CYGWIN__)
-            const time_t seconds = (time_t) *timeout;
-            const long nanoseconds = (long) ((*timeout - seconds) * 1e9);
-            const struct timespec ts = { seconds, nanoseconds };
-            const int result = ppoll(fds, count, &ts, NULL);
-#elif defined(__NetBSD__)
-            const time_t seconds = (time_t) *timeout;
-            const long nanoseconds = (long) ((*timeout - seconds) * 1e9);
-            const struct timespec ts = { seconds, nanoseconds };
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__CYGWIN__) || defined(__NetBSD__)
+            const uint64_t seconds = remaining / frequency;
+            const struct timespec ts =
+            {
+                (time_t) (seconds < INT_MAX ? seconds : INT_MAX),
+                (long) ((remaining % frequency) * 1000000000 / frequency)
+            };
+#if defined(__NetBSD__)
             const int result = pollts(fds, count, &ts, NULL);
 #else
-            const int milliseconds = (int) (*timeout * 1e3);
-            const int result = poll(fds, count, milliseconds);
+            const int result = ppoll(fds, count, &ts, NULL);
+#endif
+#else
+            // Round up so that poll never returns before the deadline
+            const uint64_t milliseconds = remaining / frequency * 1000 +
+                ((remaining % frequency) * 1000 + frequency - 1) / frequency;
+            const int result = poll(fds, count, (int) (milliseconds < INT_MAX ? milliseconds : INT_MAX));
 #endif
             const int error = errno; // clock_gettime may overwrite our error
 
-            *timeout -= (_glfwPlatformGetTimerValue() - base) /
-                (double) _glfwPlatformGetTimerFrequency();
-
             if (result > 0)
                 return GLFW_TRUE;
             else if (result == -1 && error != EINTR && error != EAGAIN)
                 return GLFW_FALSE;
-            else if (*timeout <= 0.0)
+            else if (_glfwPlatformGetTimerValue() >= *deadline)
                 return GLFW_FALSE;
         }
         else
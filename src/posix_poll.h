@@ -26,5 +26,5 @@
 
 #include <poll.h>
 
-GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout);
+GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, const uint64_t* deadline);
 
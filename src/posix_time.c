@@ -30,8 +30,91 @@
 #if defined(GLFW_BUILD_POSIX_TIMER)
 
 #include <unistd.h>
+#include <errno.h>
 #include <sys/time.h>
 
+#if defined(__x86_64__) && defined(__SIZEOF_INT128__) && defined(__GNUC__)
+ #define GLFW_POSIX_TSC_TIMER
+ #include <cpuid.h>
+ #include <x86intrin.h>
+#endif
+
+
+static uint64_t getClockValue(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t) ts.tv_sec * _glfw.timer.posix.frequency + (uint64_t) ts.tv_nsec;
+}
+
+// Returns whether the timer can be compared directly to the monotonic clock
+//
+static bool isMonotonicTimer(void)
+{
+#if defined(_POSIX_MONOTONIC_CLOCK)
+    return _glfw.timer.posix.clock == CLOCK_MONOTONIC && !_glfw.timer.posix.tsc;
+#else
+    return false;
+#endif
+}
+
+#if defined(GLFW_POSIX_TSC_TIMER)
+
+// Samples the clock and the TSC as close together in time as possible
+//
+static void sampleTSC(uint64_t* time, uint64_t* tsc)
+{
+    uint64_t smallest = UINT64_MAX;
+
+    for (int i = 0;  i < 8;  i++)
+    {
+        const uint64_t before = __rdtsc();
+        const uint64_t value = getClockValue(_glfw.timer.posix.clock);
+        const uint64_t after = __rdtsc();
+
+        if (after - before < smallest)
+        {
+            smallest = after - before;
+            *time = value;
+            *tsc = before + (after - before) / 2;
+        }
+    }
+}
+
+// Calibrates the TSC against the clock if it runs at a constant rate
+//
+static bool initTSC(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007)
+        return false;
+
+    // Only an invariant TSC ticks at the same rate in all power states
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    if (!(edx & (1u << 8)))
+        return false;
+
+    uint64_t startTime, startTSC, endTime, endTSC;
+    const struct timespec delay = { 0, 10000000 };
+
+    sampleTSC(&startTime, &startTSC);
+    nanosleep(&delay, NULL);
+    sampleTSC(&endTime, &endTSC);
+
+    if (endTSC <= startTSC || endTime - startTime < 1000000)
+        return false;
+
+    // Nanoseconds per tick as 32.32 fixed point
+    _glfw.timer.posix.tscScale = (uint64_t)
+        (((unsigned __int128) (endTime - startTime) << 32) / (endTSC - startTSC));
+    _glfw.timer.posix.tscBase = endTSC;
+    _glfw.timer.posix.tscTime = endTime;
+    return true;
+}
+
+#endif // GLFW_POSIX_TSC_TIMER
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -47,13 +130,35 @@ void _glfwPlatformInitTimer(void)
     if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
         _glfw.timer.posix.clock = CLOCK_MONOTONIC;
 #endif
+
+#if defined(CLOCK_MONOTONIC_RAW)
+    if (_glfw.hints.init.timerSource == GLFW_TIMER_SOURCE_MONOTONIC_RAW)
+    {
+        struct timespec ts;
+        if (clock_gettime(CLOCK_MONOTONIC_RAW, &ts) == 0)
+            _glfw.timer.posix.clock = CLOCK_MONOTONIC_RAW;
+    }
+#endif
+
+#if defined(GLFW_POSIX_TSC_TIMER)
+    if (_glfw.hints.init.timerSource == GLFW_TIMER_SOURCE_TSC)
+        _glfw.timer.posix.tsc = initTSC();
+#endif
 }
 
 uint64_t _glfwPlatformGetTimerValue(void)
 {
-    struct timespec ts;
-    clock_gettime(_glfw.timer.posix.clock, &ts);
-    return (uint64_t) ts.tv_sec * _glfw.timer.posix.frequency + (uint64_t) ts.tv_nsec;
+#if defined(GLFW_POSIX_TSC_TIMER)
+    if (_glfw.timer.posix.tsc)
+    {
+        // NOTE: The TSC of another core may be very slightly behind the base
+        const int64_t ticks = (int64_t) (__rdtsc() - _glfw.timer.posix.tscBase);
+        return _glfw.timer.posix.tscTime +
+            (uint64_t) (((__int128) ticks * _glfw.timer.posix.tscScale) >> 32);
+    }
+#endif
+
+    return getClockValue(_glfw.timer.posix.clock);
 }
 
 uint64_t _glfwPlatformGetTimerFrequency(void)
@@ -61,5 +166,77 @@ uint64_t _glfwPlatformGetTimerFrequency(void)
     return _glfw.timer.posix.frequency;
 }
 
+void _glfwPlatformSleepUntil(uint64_t deadline)
+{
+    const uint64_t frequency = _glfw.timer.posix.frequency;
+
+#if defined(TIMER_ABSTIME)
+    clockid_t clock = _glfw.timer.posix.clock;
+
+#if defined(_POSIX_MONOTONIC_CLOCK)
+    // The raw clock and the TSC cannot be slept on, so move the deadline onto
+    // the monotonic clock
+    if (clock != CLOCK_REALTIME && !isMonotonicTimer())
+    {
+        const uint64_t now = _glfwPlatformGetTimerValue();
+        if (deadline <= now)
+            return;
+
+        deadline = getClockValue(CLOCK_MONOTONIC) + (deadline - now);
+        clock = CLOCK_MONOTONIC;
+    }
+#endif
+
+    const struct timespec ts =
+    {
+        (time_t) (deadline / frequency),
+        (long) ((deadline % frequency) * 1000000000 / frequency)
+    };
+
+    while (clock_nanosleep(clock, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+#else
+    for (;;)
+    {
+        const uint64_t now = _glfwPlatformGetTimerValue();
+        if (now >= deadline)
+            break;
+
+        const uint64_t remaining = deadline - now;
+        const struct timespec ts =
+        {
+            (time_t) (remaining / frequency),
+            (long) ((remaining % frequency) * 1000000000 / frequency)
+        };
+
+        if (nanosleep(&ts, NULL) == 0)
+            break;
+    }
+#endif
+}
+
+GLFWbool _glfwPlatformConvertMonotonicTime(uint64_t nanoseconds, uint64_t* value)
+{
+#if defined(_POSIX_MONOTONIC_CLOCK)
+    if (isMonotonicTimer())
+    {
+        *value = nanoseconds;
+        return GLFW_TRUE;
+    }
+
+    // NOTE: The raw clock and the TSC run at slightly different rates than the
+    //       monotonic clock, so relate them to each other at the current time
+    if (_glfw.timer.posix.clock != CLOCK_REALTIME)
+    {
+        const uint64_t timer = _glfwPlatformGetTimerValue();
+        const uint64_t monotonic = getClockValue(CLOCK_MONOTONIC);
+        *value = timer + (nanoseconds - monotonic);
+        return GLFW_TRUE;
+    }
+#endif
+
+    return GLFW_FALSE;
+}
+
 #endif // GLFW_BUILD_POSIX_TIMER
 
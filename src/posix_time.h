@@ -37,5 +37,10 @@ typedef struct _GLFWtimerPOSIX
 {
     clockid_t   clock;
     uint64_t    frequency;
+    // Calibration of the invariant TSC against the clock, if in use
+    bool        tsc;
+    uint64_t    tscBase;
+    uint64_t    tscTime;
+    uint64_t    tscScale;
 } _GLFWtimerPOSIX;
 
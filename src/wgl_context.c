@@ -513,6 +513,8 @@ GLFWbool _glfwInitWGL(void)
 
 void _glfwTerminateWGL(void)
 {
+    _glfwFreeProcCache(&_glfw.wgl.procs);
+
     _glfwPlatformFreeModule(_glfw.wgl.instance);
     _glfw.wgl.instance = NULL;
 }
@@ -747,6 +749,9 @@ GLFWbool _glfwCreateContextWGL(_GLFWwindow* window,
         }
     }
 
+    // The initial swap interval of a WGL context is one
+    window->context.interval = 1;
+
     window->context.makeCurrent = makeContextCurrentWGL;
     window->context.swapBuffers = swapBuffersWGL;
     window->context.swapInterval = swapIntervalWGL;
@@ -754,6 +759,11 @@ GLFWbool _glfwCreateContextWGL(_GLFWwindow* window,
     window->context.getProcAddress = getProcAddressWGL;
     window->context.destroy = destroyContextWGL;
 
+    // NOTE: WGL allows function addresses to differ between pixel formats, but
+    //       in practice they only differ between drivers and a process renders
+    //       with a single driver
+    window->context.procs = &_glfw.wgl.procs;
+
     return GLFW_TRUE;
 }
 
@@ -607,6 +607,7 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampWin32,
         .createWindow = _glfwCreateWindowWin32,
         .destroyWindow = _glfwDestroyWindowWin32,
+        .createOffscreenContext = _glfwCreateOffscreenContextWin32,
         .setWindowTitle = _glfwSetWindowTitleWin32,
         .setWindowIcon = _glfwSetWindowIconWin32,
         .getWindowPos = _glfwGetWindowPosWin32,
@@ -638,9 +639,13 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingWin32,
         .setWindowOpacity = _glfwSetWindowOpacityWin32,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughWin32,
+        .getWindowPixelBuffer = _glfwGetWindowPixelBufferWin32,
+        .presentPixelBuffer = _glfwPresentPixelBufferWin32,
+        .setWindowRenderScale = _glfwSetWindowRenderScaleWin32,
+        .requestClipboardString = _glfwRequestClipboardStringWin32,
         .pollEvents = _glfwPollEventsWin32,
         .waitEvents = _glfwWaitEventsWin32,
-        .waitEventsTimeout = _glfwWaitEventsTimeoutWin32,
+        .waitEventsUntil = _glfwWaitEventsUntilWin32,
         .postEmptyEvent = _glfwPostEmptyEventWin32,
         .getEGLPlatform = _glfwGetEGLPlatformWin32,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayWin32,
@@ -348,6 +348,8 @@ typedef struct _GLFWlibraryWGL
     bool                                ARB_create_context_robustness;
     bool                                ARB_create_context_no_error;
     bool                                ARB_context_flush_control;
+
+    _GLFWproccache                      procs;
 } _GLFWlibraryWGL;
 
 // Win32-specific per-window data
@@ -484,6 +486,7 @@ void _glfwGetHMONITORContentScaleWin32(HMONITOR handle, float* xscale, float* ys
 
 GLFWbool _glfwCreateWindowWin32(_GLFWwindow* window, const _GLFWwndconfig* wndconfig, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwDestroyWindowWin32(_GLFWwindow* window);
+GLFWbool _glfwCreateOffscreenContextWin32(_GLFWwindow* window, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwSetWindowTitleWin32(_GLFWwindow* window, const char* title);
 void _glfwSetWindowIconWin32(_GLFWwindow* window, int count, const GLFWimage* images);
 void _glfwGetWindowPosWin32(_GLFWwindow* window, int* xpos, int* ypos);
@@ -513,6 +516,9 @@ void _glfwSetWindowResizableWin32(_GLFWwindow* window, GLFWbool enabled);
 void _glfwSetWindowDecoratedWin32(_GLFWwindow* window, GLFWbool enabled);
 void _glfwSetWindowFloatingWin32(_GLFWwindow* window, GLFWbool enabled);
 void _glfwSetWindowMousePassthroughWin32(_GLFWwindow* window, GLFWbool enabled);
+unsigned char* _glfwGetWindowPixelBufferWin32(_GLFWwindow* window, int* width, int* height, int* stride);
+void _glfwPresentPixelBufferWin32(_GLFWwindow* window, const int* rects, int count);
+GLFWbool _glfwSetWindowRenderScaleWin32(_GLFWwindow* window, float scale);
 float _glfwGetWindowOpacityWin32(_GLFWwindow* window);
 void _glfwSetWindowOpacityWin32(_GLFWwindow* window, float opacity);
 
@@ -521,7 +527,7 @@ GLFWbool _glfwRawMouseMotionSupportedWin32(void);
 
 void _glfwPollEventsWin32(void);
 void _glfwWaitEventsWin32(void);
-void _glfwWaitEventsTimeoutWin32(double timeout);
+void _glfwWaitEventsUntilWin32(uint64_t deadline);
 void _glfwPostEmptyEventWin32(void);
 
 void _glfwGetCursorPosWin32(_GLFWwindow* window, double* xpos, double* ypos);
@@ -535,6 +541,7 @@ void _glfwDestroyCursorWin32(_GLFWcursor* cursor);
 void _glfwSetCursorWin32(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringWin32(const char* string);
 const char* _glfwGetClipboardStringWin32(void);
+void _glfwRequestClipboardStringWin32(_GLFWwindow* window);
 
 EGLenum _glfwGetEGLPlatformWin32(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayWin32(void);
@@ -50,5 +50,41 @@ uint64_t _glfwPlatformGetTimerFrequency(void)
     return _glfw.timer.win32.frequency;
 }
 
+void _glfwPlatformSleepUntil(uint64_t deadline)
+{
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    if (deadline <= now)
+        return;
+
+    // Waitable timers are used because Sleep is limited to the scheduler tick
+    // The high resolution flag is only supported on Windows 10 version 1803 and
+    // later, so fall back to a regular timer if creation fails
+    HANDLE timer = CreateWaitableTimerExW(NULL, NULL,
+                                          CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                          TIMER_ALL_ACCESS);
+    if (!timer)
+        timer = CreateWaitableTimerW(NULL, TRUE, NULL);
+
+    const uint64_t frequency = _glfw.timer.win32.frequency;
+    const uint64_t remaining = deadline - now;
+    LARGE_INTEGER due;
+    // Negative values are relative, in 100 nanosecond intervals
+    due.QuadPart = -(LONGLONG) (remaining / frequency * 10000000 +
+                                (remaining % frequency) * 10000000 / frequency);
+
+    if (timer && SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE))
+        WaitForSingleObject(timer, INFINITE);
+    else
+        Sleep((DWORD) (remaining / frequency * 1000 + (remaining % frequency) * 1000 / frequency));
+
+    if (timer)
+        CloseHandle(timer);
+}
+
+GLFWbool _glfwPlatformConvertMonotonicTime(uint64_t nanoseconds, uint64_t* value)
+{
+    return GLFW_FALSE;
+}
+
 #endif // GLFW_BUILD_WIN32_TIMER
 
@@ -1488,6 +1488,13 @@ GLFWbool _glfwCreateWindowWin32(_GLFWwindow* window,
                                 const _GLFWctxconfig* ctxconfig,
                                 const _GLFWfbconfig* fbconfig)
 {
+    if (wndconfig->parent)
+    {
+        _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                        "Win32: Window layers are not yet implemented");
+        return GLFW_FALSE;
+    }
+
     if (!createNativeWindow(window, wndconfig, fbconfig))
         return GLFW_FALSE;
 
@@ -1573,6 +1580,34 @@ void _glfwDestroyWindowWin32(_GLFWwindow* window)
         DestroyIcon(window->win32.smallIcon);
 }
 
+GLFWbool _glfwCreateOffscreenContextWin32(_GLFWwindow* window,
+                                          const _GLFWctxconfig* ctxconfig,
+                                          const _GLFWfbconfig* fbconfig)
+{
+    if (ctxconfig->source == GLFW_NATIVE_CONTEXT_API)
+    {
+        _glfwInputError(GLFW_API_UNAVAILABLE,
+                        "WGL: Offscreen contexts are not supported");
+        return GLFW_FALSE;
+    }
+    else if (ctxconfig->source == GLFW_EGL_CONTEXT_API)
+    {
+        if (!_glfwInitEGL())
+            return GLFW_FALSE;
+        if (!_glfwCreateContextEGL(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
+    }
+    else if (ctxconfig->source == GLFW_OSMESA_CONTEXT_API)
+    {
+        if (!_glfwInitOSMesa())
+            return GLFW_FALSE;
+        if (!_glfwCreateContextOSMesa(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
 void _glfwSetWindowTitleWin32(_GLFWwindow* window, const char* title)
 {
     WCHAR* wideTitle = _glfwCreateWideStringFromUTF8Win32(title);
@@ -2035,6 +2070,28 @@ void _glfwSetWindowMousePassthroughWin32(_GLFWwindow* window, GLFWbool enabled)
         SetLayeredWindowAttributes(window->win32.handle, key, alpha, flags);
 }
 
+unsigned char* _glfwGetWindowPixelBufferWin32(_GLFWwindow* window,
+                                              int* width, int* height,
+                                              int* stride)
+{
+    _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                    "Win32: Window pixel buffers are not yet implemented");
+    return NULL;
+}
+
+void _glfwPresentPixelBufferWin32(_GLFWwindow* window, const int* rects, int count)
+{
+    _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                    "Win32: Window pixel buffers are not yet implemented");
+}
+
+GLFWbool _glfwSetWindowRenderScaleWin32(_GLFWwindow* window, float scale)
+{
+    _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                    "Win32: Window render scaling is not supported");
+    return GLFW_FALSE;
+}
+
 float _glfwGetWindowOpacityWin32(_GLFWwindow* window)
 {
     BYTE alpha;
@@ -2177,9 +2234,22 @@ void _glfwWaitEventsWin32(void)
     _glfwPollEventsWin32();
 }
 
-void _glfwWaitEventsTimeoutWin32(double timeout)
+void _glfwWaitEventsUntilWin32(uint64_t deadline)
 {
-    MsgWaitForMultipleObjects(0, NULL, FALSE, (DWORD) (timeout * 1e3), QS_ALLINPUT);
+    const uint64_t now = _glfwPlatformGetTimerValue();
+
+    if (deadline > now)
+    {
+        const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+        const uint64_t remaining = deadline - now;
+        // Round up so that the wait never ends before the deadline
+        const uint64_t milliseconds = remaining / frequency * 1000 +
+            ((remaining % frequency) * 1000 + frequency - 1) / frequency;
+
+        MsgWaitForMultipleObjects(0, NULL, FALSE,
+                                  (DWORD) (milliseconds < INFINITE ? milliseconds : INFINITE - 1),
+                                  QS_ALLINPUT);
+    }
 
     _glfwPollEventsWin32();
 }
@@ -2451,6 +2521,12 @@ const char* _glfwGetClipboardStringWin32(void)
     return _glfw.win32.clipboardString;
 }
 
+void _glfwRequestClipboardStringWin32(_GLFWwindow* window)
+{
+    // The clipboard is read synchronously on Windows
+    _glfwInputClipboardString(window, _glfwGetClipboardStringWin32());
+}
+
 EGLenum _glfwGetEGLPlatformWin32(EGLint** attribs)
 {
     if (_glfw.egl.ANGLE_platform_angle)
@@ -177,6 +177,70 @@ void _glfwInputWindowMonitor(_GLFWwindow* window, _GLFWmonitor* monitor)
 //////                        GLFW public API                       //////
 //////////////////////////////////////////////////////////////////////////
 
+// Creates a window or window layer from the specified configuration
+//
+static _GLFWwindow* createWindow(const char* title,
+                                 _GLFWmonitor* monitor,
+                                 const _GLFWwndconfig* wndconfig,
+                                 const _GLFWctxconfig* ctxconfig,
+                                 const _GLFWfbconfig* fbconfig)
+{
+    if (!_glfwIsValidContextConfig(ctxconfig))
+        return NULL;
+
+    _GLFWwindow* window = _glfw_calloc(1, sizeof(_GLFWwindow));
+
+    // NOTE: The window list is locked as the Null platform allows windows to
+    //       be created and destroyed from any thread
+    _glfwPlatformLockMutex(&_glfw.windowLock);
+    window->next = _glfw.windowListHead;
+    _glfw.windowListHead = window;
+
+    if (wndconfig->parent)
+    {
+        window->nextLayer = wndconfig->parent->layers;
+        wndconfig->parent->layers = window;
+    }
+
+    _glfwPlatformUnlockMutex(&_glfw.windowLock);
+
+    window->videoMode.width       = wndconfig->width;
+    window->videoMode.height      = wndconfig->height;
+    window->videoMode.redBits     = fbconfig->redBits;
+    window->videoMode.greenBits   = fbconfig->greenBits;
+    window->videoMode.blueBits    = fbconfig->blueBits;
+    window->videoMode.refreshRate = _glfw.hints.refreshRate;
+
+    window->monitor          = monitor;
+    window->parent           = wndconfig->parent;
+    window->resizable        = wndconfig->resizable;
+    window->decorated        = wndconfig->decorated;
+    window->autoIconify      = wndconfig->autoIconify;
+    window->floating         = wndconfig->floating;
+    window->focusOnShow      = wndconfig->focusOnShow;
+    window->mousePassthrough = wndconfig->mousePassthrough;
+    window->renderScale      = 1.f;
+    window->cursorMode       = GLFW_CURSOR_NORMAL;
+
+    window->doublebuffer = fbconfig->doublebuffer;
+
+    window->minwidth    = GLFW_DONT_CARE;
+    window->minheight   = GLFW_DONT_CARE;
+    window->maxwidth    = GLFW_DONT_CARE;
+    window->maxheight   = GLFW_DONT_CARE;
+    window->numer       = GLFW_DONT_CARE;
+    window->denom       = GLFW_DONT_CARE;
+    window->title       = _glfw_strdup(title);
+
+    if (!_glfw.platform.createWindow(window, wndconfig, ctxconfig, fbconfig))
+    {
+        glfwDestroyWindow((GLFWwindow*) window);
+        return NULL;
+    }
+
+    return window;
+}
+
 GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
                                      const char* title,
                                      GLFWmonitor* monitor,
@@ -185,7 +249,6 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     _GLFWfbconfig fbconfig;
     _GLFWctxconfig ctxconfig;
     _GLFWwndconfig wndconfig;
-    _GLFWwindow* window;
 
     assert(title != NULL);
     assert(width >= 0);
@@ -210,46 +273,66 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     wndconfig.height  = height;
     ctxconfig.share   = (_GLFWwindow*) share;
 
-    if (!_glfwIsValidContextConfig(&ctxconfig))
-        return NULL;
+    return (GLFWwindow*) createWindow(title, (_GLFWmonitor*) monitor,
+                                      &wndconfig, &ctxconfig, &fbconfig);
+}
 
-    window = _glfw_calloc(1, sizeof(_GLFWwindow));
-    window->next = _glfw.windowListHead;
-    _glfw.windowListHead = window;
+GLFWAPI GLFWwindow* glfwCreateWindowLayer(GLFWwindow* handle,
+                                          int width, int height,
+                                          GLFWwindow* share)
+{
+    _GLFWfbconfig fbconfig;
+    _GLFWctxconfig ctxconfig;
+    _GLFWwndconfig wndconfig;
 
-    window->videoMode.width       = width;
-    window->videoMode.height      = height;
-    window->videoMode.redBits     = fbconfig.redBits;
-    window->videoMode.greenBits   = fbconfig.greenBits;
-    window->videoMode.blueBits    = fbconfig.blueBits;
-    window->videoMode.refreshRate = _glfw.hints.refreshRate;
+    assert(width >= 0);
+    assert(height >= 0);
 
-    window->monitor          = (_GLFWmonitor*) monitor;
-    window->resizable        = wndconfig.resizable;
-    window->decorated        = wndconfig.decorated;
-    window->autoIconify      = wndconfig.autoIconify;
-    window->floating         = wndconfig.floating;
-    window->focusOnShow      = wndconfig.focusOnShow;
-    window->mousePassthrough = wndconfig.mousePassthrough;
-    window->cursorMode       = GLFW_CURSOR_NORMAL;
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-    window->doublebuffer = fbconfig.doublebuffer;
+    _GLFWwindow* parent = (_GLFWwindow*) handle;
+    assert(parent != NULL);
 
-    window->minwidth    = GLFW_DONT_CARE;
-    window->minheight   = GLFW_DONT_CARE;
-    window->maxwidth    = GLFW_DONT_CARE;
-    window->maxheight   = GLFW_DONT_CARE;
-    window->numer       = GLFW_DONT_CARE;
-    window->denom       = GLFW_DONT_CARE;
-    window->title       = _glfw_strdup(title);
+    if (width <= 0 || height <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid window layer size %ix%i",
+                        width, height);
+
+        return NULL;
+    }
 
-    if (!_glfw.platform.createWindow(window, &wndconfig, &ctxconfig, &fbconfig))
+    if (parent->offscreen || parent->monitor)
     {
-        glfwDestroyWindow((GLFWwindow*) window);
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Window layers require a windowed mode parent window");
         return NULL;
     }
 
-    return (GLFWwindow*) window;
+    fbconfig  = _glfw.hints.framebuffer;
+    ctxconfig = _glfw.hints.context;
+    wndconfig = _glfw.hints.window;
+
+    wndconfig.xpos    = 0;
+    wndconfig.ypos    = 0;
+    wndconfig.width   = width;
+    wndconfig.height  = height;
+    wndconfig.parent  = parent;
+    ctxconfig.share   = (_GLFWwindow*) share;
+
+    // Layers are shown with their parent and never receive input
+    wndconfig.resizable        = false;
+    wndconfig.visible          = true;
+    wndconfig.decorated        = false;
+    wndconfig.focused          = false;
+    wndconfig.autoIconify      = false;
+    wndconfig.floating         = false;
+    wndconfig.maximized        = false;
+    wndconfig.centerCursor     = false;
+    wndconfig.focusOnShow      = false;
+    wndconfig.mousePassthrough = true;
+
+    return (GLFWwindow*) createWindow("", NULL, &wndconfig, &ctxconfig, &fbconfig);
 }
 
 void glfwDefaultWindowHints(void)
@@ -262,6 +345,7 @@ void glfwDefaultWindowHints(void)
     _glfw.hints.context.source = GLFW_NATIVE_CONTEXT_API;
     _glfw.hints.context.major  = 1;
     _glfw.hints.context.minor  = 0;
+    _glfw.hints.context.osmesa.format = GLFW_OSMESA_RGBA8;
 
     // The default is a focused, visible, resizable window with decorations
     memset(&_glfw.hints.window, 0, sizeof(_glfw.hints.window));
@@ -378,6 +462,9 @@ GLFWAPI void glfwWindowHint(int hint, int value)
         case GLFW_WIN32_SHOWDEFAULT:
             _glfw.hints.window.win32.showDefault = value;
             return;
+        case GLFW_WAYLAND_ALLOW_TEARING:
+            _glfw.hints.window.wl.allowTearing = value;
+            return;
         case GLFW_COCOA_GRAPHICS_SWITCHING:
             _glfw.hints.context.nsgl.offline = value;
             return;
@@ -403,6 +490,12 @@ GLFWAPI void glfwWindowHint(int hint, int value)
         case GLFW_CONTEXT_CREATION_API:
             _glfw.hints.context.source = value;
             return;
+        case GLFW_OSMESA_PIXEL_FORMAT:
+            _glfw.hints.context.osmesa.format = value;
+            return;
+        case GLFW_OSMESA_DOUBLEBUFFER:
+            _glfw.hints.context.osmesa.doublebuffer = value;
+            return;
         case GLFW_CONTEXT_VERSION_MAJOR:
             _glfw.hints.context.major = value;
             return;
@@ -474,24 +567,81 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
     if (window == NULL)
         return;
 
+    if (window->pool)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Pooled contexts are destroyed with their pool");
+        return;
+    }
+
+    // NOTE: The Null platform allows windows to be destroyed from any thread,
+    //       so the main thread may still be delivering a focus loss that reads
+    //       the callbacks cleared below
+    if (_glfw.platform.platformID == GLFW_PLATFORM_NULL && !window->offscreen)
+        _glfwReleaseWindowFocusNull(window);
+
     // Clear all callbacks to avoid exposing a half torn-down window object
     memset(&window->callbacks, 0, sizeof(window->callbacks));
 
+    // Layers are destroyed before their parent window, each unlinking itself
+    // from the layer list of the parent
+    for (;;)
+    {
+        _glfwPlatformLockMutex(&_glfw.windowLock);
+        _GLFWwindow* layer = window->layers;
+        _glfwPlatformUnlockMutex(&_glfw.windowLock);
+
+        if (!layer)
+            break;
+
+        glfwDestroyWindow((GLFWwindow*) layer);
+    }
+
+    // NOTE: The readback buffers can only be deleted while the context still
+    //       exists
+    _glfwDestroyReadback(window);
+
     // The window's context must not be current on another thread when the
     // window is destroyed
     if (window == _glfwPlatformGetTls(&_glfw.contextSlot))
         glfwMakeContextCurrent(NULL);
 
-    _glfw.platform.destroyWindow(window);
+    if (window->offscreen)
+    {
+        if (window->context.destroy)
+            window->context.destroy(window);
+    }
+    else
+        _glfw.platform.destroyWindow(window);
+
+    _glfwFreeExtensionSet(&window->context.extensions);
 
     // Unlink window from global linked list
     {
-        _GLFWwindow** prev = &_glfw.windowListHead;
+        _GLFWwindow** prev;
+
+        _glfwPlatformLockMutex(&_glfw.windowLock);
+
+        if (window->offscreen)
+            prev = &_glfw.offscreenListHead;
+        else
+            prev = &_glfw.windowListHead;
 
         while (*prev != window)
             prev = &((*prev)->next);
 
         *prev = window->next;
+
+        if (window->parent)
+        {
+            prev = &window->parent->layers;
+            while (*prev != window)
+                prev = &((*prev)->nextLayer);
+
+            *prev = window->nextLayer;
+        }
+
+        _glfwPlatformUnlockMutex(&_glfw.windowLock);
     }
 
     _glfw_free(window->title);
@@ -724,7 +874,15 @@ GLFWAPI void glfwGetFramebufferSize(GLFWwindow* handle, int* width, int* height)
     _GLFWwindow* window = (_GLFWwindow*) handle;
     assert(window != NULL);
 
-    _glfw.platform.getFramebufferSize(window, width, height);
+    if (window->offscreen)
+    {
+        if (width)
+            *width = window->offscreenWidth;
+        if (height)
+            *height = window->offscreenHeight;
+    }
+    else
+        _glfw.platform.getFramebufferSize(window, width, height);
 }
 
 GLFWAPI void glfwGetWindowFrameSize(GLFWwindow* handle,
@@ -1026,6 +1184,13 @@ GLFWAPI void glfwSetWindowMonitor(GLFWwindow* wh,
         return;
     }
 
+    if (window->parent && monitor)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Window layers cannot be made full screen");
+        return;
+    }
+
     window->videoMode.width       = width;
     window->videoMode.height      = height;
     window->videoMode.refreshRate = refreshRate;
@@ -1035,6 +1200,117 @@ GLFWAPI void glfwSetWindowMonitor(GLFWwindow* wh,
                                     refreshRate);
 }
 
+GLFWAPI unsigned char* glfwGetWindowPixelBuffer(GLFWwindow* handle,
+                                                int* width, int* height,
+                                                int* stride)
+{
+    int bufferWidth = 0, bufferHeight = 0, bufferStride = 0;
+
+    if (width)
+        *width = 0;
+    if (height)
+        *height = 0;
+    if (stride)
+        *stride = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (window->context.client != GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Pixel buffers require the window to have the client API set to GLFW_NO_API");
+        return NULL;
+    }
+
+    _glfw.platform.getFramebufferSize(window, &bufferWidth, &bufferHeight);
+    if (bufferWidth <= 0 || bufferHeight <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Cannot retrieve a pixel buffer for an empty framebuffer");
+        return NULL;
+    }
+
+    unsigned char* pixels =
+        _glfw.platform.getWindowPixelBuffer(window,
+                                            &bufferWidth,
+                                            &bufferHeight,
+                                            &bufferStride);
+    if (!pixels)
+        return NULL;
+
+    if (width)
+        *width = bufferWidth;
+    if (height)
+        *height = bufferHeight;
+    if (stride)
+        *stride = bufferStride;
+
+    return pixels;
+}
+
+GLFWAPI void glfwPresentPixelBuffer(GLFWwindow* handle, const int* rects, int count)
+{
+    assert(count >= 0);
+    assert(rects != NULL || count == 0);
+
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid damage rectangle count %i", count);
+        return;
+    }
+
+    if (window->context.client != GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Pixel buffers require the window to have the client API set to GLFW_NO_API");
+        return;
+    }
+
+    _glfw.platform.presentPixelBuffer(window, rects, count);
+}
+
+GLFWAPI void glfwSetWindowRenderScale(GLFWwindow* handle, float scale)
+{
+    assert(scale == scale);
+    assert(scale > 0.f);
+    assert(scale <= 1.f);
+
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (scale != scale || scale <= 0.f || scale > 1.f)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid render scale %f", scale);
+        return;
+    }
+
+    if (window->renderScale == scale)
+        return;
+
+    if (_glfw.platform.setWindowRenderScale(window, scale))
+        window->renderScale = scale;
+}
+
+GLFWAPI float glfwGetWindowRenderScale(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(1.f);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    return window->renderScale;
+}
+
 GLFWAPI void glfwSetWindowUserPointer(GLFWwindow* handle, void* pointer)
 {
     _GLFW_REQUIRE_INIT();
@@ -1187,7 +1463,20 @@ GLFWAPI void glfwWaitEventsTimeout(double timeout)
         return;
     }
 
-    _glfw.platform.waitEventsTimeout(timeout);
+    const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+    const uint64_t base = _glfwPlatformGetTimerValue();
+    uint64_t deadline = UINT64_MAX;
+
+    if (timeout < (double) (UINT64_MAX - base) / frequency)
+        deadline = base + (uint64_t) (timeout * frequency);
+
+    _glfw.platform.waitEventsUntil(deadline);
+}
+
+GLFWAPI void glfwWaitEventsUntil(uint64_t deadline)
+{
+    _GLFW_REQUIRE_INIT();
+    _glfw.platform.waitEventsUntil(deadline);
 }
 
 GLFWAPI void glfwPostEmptyEvent(void)
@@ -49,6 +49,9 @@
 #include "fractional-scale-v1-client-protocol.h"
 #include "xdg-activation-v1-client-protocol.h"
 #include "idle-inhibit-unstable-v1-client-protocol.h"
+#include "presentation-time-client-protocol.h"
+#include "cursor-shape-v1-client-protocol.h"
+#include "tearing-control-v1-client-protocol.h"
 
 // NOTE: Versions of wayland-scanner prior to 1.17.91 named every global array of
 //       wl_interface pointers 'types', making it impossible to combine several unmodified
@@ -91,6 +94,18 @@
 #include "idle-inhibit-unstable-v1-client-protocol-code.h"
 #undef types
 
+#define types _glfw_presentation_time_types
+#include "presentation-time-client-protocol-code.h"
+#undef types
+
+#define types _glfw_cursor_shape_types
+#include "cursor-shape-v1-client-protocol-code.h"
+#undef types
+
+#define types _glfw_tearing_control_types
+#include "tearing-control-v1-client-protocol-code.h"
+#undef types
+
 static void wmBaseHandlePing(void* userData,
                              struct xdg_wm_base* wmBase,
                              uint32_t serial)
@@ -103,6 +118,18 @@ static const struct xdg_wm_base_listener wmBaseListener =
     wmBaseHandlePing
 };
 
+static void presentationHandleClockId(void* userData,
+                                      struct wp_presentation* presentation,
+                                      uint32_t clockId)
+{
+    _glfw.wl.presentationClock = clockId;
+}
+
+static const struct wp_presentation_listener presentationListener =
+{
+    presentationHandleClockId
+};
+
 static void registryHandleGlobal(void* userData,
                                  struct wl_registry* registry,
                                  uint32_t name,
@@ -113,7 +140,7 @@ static void registryHandleGlobal(void* userData,
     {
         _glfw.wl.compositor =
             wl_registry_bind(registry, name, &wl_compositor_interface,
-                             _glfw_min(3, version));
+                             _glfw_min(4, version));
     }
     else if (strcmp(interface, "wl_subcompositor") == 0)
     {
@@ -201,6 +228,28 @@ static void registryHandleGlobal(void* userData,
                              &wp_fractional_scale_manager_v1_interface,
                              1);
     }
+    else if (strcmp(interface, "wp_presentation") == 0)
+    {
+        _glfw.wl.presentation =
+            wl_registry_bind(registry, name, &wp_presentation_interface, 1);
+        wp_presentation_add_listener(_glfw.wl.presentation,
+                                     &presentationListener,
+                                     NULL);
+    }
+    else if (strcmp(interface, "wp_cursor_shape_manager_v1") == 0)
+    {
+        _glfw.wl.cursorShapeManager =
+            wl_registry_bind(registry, name,
+                             &wp_cursor_shape_manager_v1_interface,
+                             1);
+    }
+    else if (strcmp(interface, "wp_tearing_control_manager_v1") == 0)
+    {
+        _glfw.wl.tearingControlManager =
+            wl_registry_bind(registry, name,
+                             &wp_tearing_control_manager_v1_interface,
+                             1);
+    }
 }
 
 static void registryHandleGlobalRemove(void* userData,
@@ -252,6 +301,19 @@ static const struct wl_callback_listener libdecorReadyListener =
     libdecorReadyCallback
 };
 
+static void initialSyncCallback(void* userData,
+                                struct wl_callback* callback,
+                                uint32_t time)
+{
+    wl_callback_destroy(callback);
+    _glfw.wl.initialSync = NULL;
+}
+
+static const struct wl_callback_listener initialSyncListener =
+{
+    initialSyncCallback
+};
+
 // Create key code translation tables
 //
 static void createKeyTables(void)
@@ -385,8 +447,22 @@ static void createKeyTables(void)
     }
 }
 
-static GLFWbool loadCursorTheme(void)
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Loads the cursor themes on first use
+//
+GLFWbool _glfwLoadCursorThemeWayland(void)
 {
+    if (_glfw.wl.cursorTheme)
+        return GLFW_TRUE;
+
+    // NOTE: This is called on pointer motion over the fallback decorations, so
+    //       a failure is reported only once instead of on every event
+    if (_glfw.wl.cursorThemeFailed)
+        return GLFW_FALSE;
+
     int cursorSize = 16;
 
     const char* sizeString = getenv("XCURSOR_SIZE");
@@ -403,17 +479,17 @@ static GLFWbool loadCursorTheme(void)
     _glfw.wl.cursorTheme = wl_cursor_theme_load(themeName, cursorSize, _glfw.wl.shm);
     if (!_glfw.wl.cursorTheme)
     {
+        _glfw.wl.cursorThemeFailed = GLFW_TRUE;
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "Wayland: Failed to load default cursor theme");
         return GLFW_FALSE;
     }
 
     // If this happens to be NULL, we just fallback to the scale=1 version.
+    // It is only attempted once, together with the scale=1 version.
     _glfw.wl.cursorThemeHiDPI =
         wl_cursor_theme_load(themeName, cursorSize * 2, _glfw.wl.shm);
 
-    _glfw.wl.cursorSurface = wl_compositor_create_surface(_glfw.wl.compositor);
-    _glfw.wl.cursorTimerfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
     return GLFW_TRUE;
 }
 
@@ -465,6 +541,7 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampWayland,
         .createWindow = _glfwCreateWindowWayland,
         .destroyWindow = _glfwDestroyWindowWayland,
+        .createOffscreenContext = _glfwCreateOffscreenContextWayland,
         .setWindowTitle = _glfwSetWindowTitleWayland,
         .setWindowIcon = _glfwSetWindowIconWayland,
         .getWindowPos = _glfwGetWindowPosWayland,
@@ -496,9 +573,13 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingWayland,
         .setWindowOpacity = _glfwSetWindowOpacityWayland,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughWayland,
+        .getWindowPixelBuffer = _glfwGetWindowPixelBufferWayland,
+        .presentPixelBuffer = _glfwPresentPixelBufferWayland,
+        .setWindowRenderScale = _glfwSetWindowRenderScaleWayland,
+        .requestClipboardString = _glfwRequestClipboardStringWayland,
         .pollEvents = _glfwPollEventsWayland,
         .waitEvents = _glfwWaitEventsWayland,
-        .waitEventsTimeout = _glfwWaitEventsTimeoutWayland,
+        .waitEventsUntil = _glfwWaitEventsUntilWayland,
         .postEmptyEvent = _glfwPostEmptyEventWayland,
         .getEGLPlatform = _glfwGetEGLPlatformWayland,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayWayland,
@@ -556,6 +637,7 @@ int _glfwInitWayland(void)
     // These must be set before any failure checks
     _glfw.wl.keyRepeatTimerfd = -1;
     _glfw.wl.cursorTimerfd = -1;
+    _glfw.wl.clipboardTransfer.fd = -1;
 
     _glfw.wl.tag = glfwGetVersionString();
 
@@ -869,8 +951,12 @@ int _glfwInitWayland(void)
     // Sync so we got all registry objects
     wl_display_roundtrip(_glfw.wl.display);
 
-    // Sync so we got all initial output events
-    wl_display_roundtrip(_glfw.wl.display);
+    // NOTE: The initial events of the objects bound above, like those of the
+    //       outputs, are received while the rest of the library is set up and
+    //       only waited for at the end
+    _glfw.wl.initialSync = wl_display_sync(_glfw.wl.display);
+    wl_callback_add_listener(_glfw.wl.initialSync, &initialSyncListener, NULL);
+    wl_display_flush(_glfw.wl.display);
 
     if (_glfw.wl.libdecor.handle)
     {
@@ -900,8 +986,8 @@ int _glfwInitWayland(void)
         return GLFW_FALSE;
     }
 
-    if (!loadCursorTheme())
-        return GLFW_FALSE;
+    _glfw.wl.cursorSurface = wl_compositor_create_surface(_glfw.wl.compositor);
+    _glfw.wl.cursorTimerfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
 
     if (_glfw.wl.seat && _glfw.wl.dataDeviceManager)
     {
@@ -911,6 +997,13 @@ int _glfwInitWayland(void)
         _glfwAddDataDeviceListenerWayland(_glfw.wl.dataDevice);
     }
 
+    if (!_glfwWaitForCallbackWayland(&_glfw.wl.initialSync))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to receive the initial compositor state");
+        return GLFW_FALSE;
+    }
+
     return GLFW_TRUE;
 }
 
@@ -929,12 +1022,22 @@ void _glfwTerminateWayland(void)
         libdecor_unref(_glfw.wl.libdecor.context);
     }
 
+    if (_glfw.wl.initialSync)
+        wl_callback_destroy(_glfw.wl.initialSync);
+
     if (_glfw.wl.xkb.composeState)
         xkb_compose_state_unref(_glfw.wl.xkb.composeState);
-    if (_glfw.wl.xkb.keymap)
-        xkb_keymap_unref(_glfw.wl.xkb.keymap);
     if (_glfw.wl.xkb.state)
         xkb_state_unref(_glfw.wl.xkb.state);
+
+    // The current keymap is owned by the keymap cache
+    for (size_t i = 0;  i < sizeof(_glfw.wl.xkb.keymaps) / sizeof(_glfw.wl.xkb.keymaps[0]);  i++)
+    {
+        if (_glfw.wl.xkb.keymaps[i].keymap)
+            xkb_keymap_unref(_glfw.wl.xkb.keymaps[i].keymap);
+    }
+
+    _glfw_free(_glfw.wl.xkb.composeLocale);
     if (_glfw.wl.xkb.context)
         xkb_context_unref(_glfw.wl.xkb.context);
 
@@ -954,6 +1057,8 @@ void _glfwTerminateWayland(void)
         wl_subcompositor_destroy(_glfw.wl.subcompositor);
     if (_glfw.wl.compositor)
         wl_compositor_destroy(_glfw.wl.compositor);
+    _glfwTerminateShmArenaWayland();
+
     if (_glfw.wl.shm)
         wl_shm_destroy(_glfw.wl.shm);
     if (_glfw.wl.viewporter)
@@ -972,6 +1077,12 @@ void _glfwTerminateWayland(void)
         wl_data_device_destroy(_glfw.wl.dataDevice);
     if (_glfw.wl.dataDeviceManager)
         wl_data_device_manager_destroy(_glfw.wl.dataDeviceManager);
+    if (_glfw.wl.cursorShapeDevice)
+        wp_cursor_shape_device_v1_destroy(_glfw.wl.cursorShapeDevice);
+    if (_glfw.wl.cursorShapeManager)
+        wp_cursor_shape_manager_v1_destroy(_glfw.wl.cursorShapeManager);
+    if (_glfw.wl.tearingControlManager)
+        wp_tearing_control_manager_v1_destroy(_glfw.wl.tearingControlManager);
     if (_glfw.wl.pointer)
         wl_pointer_destroy(_glfw.wl.pointer);
     if (_glfw.wl.keyboard)
@@ -988,6 +1099,8 @@ void _glfwTerminateWayland(void)
         xdg_activation_v1_destroy(_glfw.wl.activationManager);
     if (_glfw.wl.fractionalScaleManager)
         wp_fractional_scale_manager_v1_destroy(_glfw.wl.fractionalScaleManager);
+    if (_glfw.wl.presentation)
+        wp_presentation_destroy(_glfw.wl.presentation);
     if (_glfw.wl.registry)
         wl_registry_destroy(_glfw.wl.registry);
     if (_glfw.wl.display)
@@ -1000,6 +1113,8 @@ void _glfwTerminateWayland(void)
         close(_glfw.wl.keyRepeatTimerfd);
     if (_glfw.wl.cursorTimerfd >= 0)
         close(_glfw.wl.cursorTimerfd);
+    if (_glfw.wl.clipboardTransfer.fd >= 0)
+        close(_glfw.wl.clipboardTransfer.fd);
 
     // Free modules only after all Wayland termination functions are called
 
@@ -1011,6 +1126,7 @@ void _glfwTerminateWayland(void)
     _glfwPlatformFreeModule(_glfw.wl.client.handle);
 
     _glfw_free(_glfw.wl.clipboardString);
+    _glfw_free(_glfw.wl.clipboardTransfer.data);
 
     memset(&_glfw.wl, 0, sizeof(_glfw.wl));
 }
@@ -142,6 +142,12 @@ struct wl_output;
 #define xdg_activation_token_v1_interface _glfw_xdg_activation_token_v1_interface
 #define wl_surface_interface _glfw_wl_surface_interface
 #define wp_fractional_scale_v1_interface _glfw_wp_fractional_scale_v1_interface
+#define wp_presentation_interface _glfw_wp_presentation_interface
+#define wp_presentation_feedback_interface _glfw_wp_presentation_feedback_interface
+#define wp_cursor_shape_manager_v1_interface _glfw_wp_cursor_shape_manager_v1_interface
+#define wp_cursor_shape_device_v1_interface _glfw_wp_cursor_shape_device_v1_interface
+#define wp_tearing_control_manager_v1_interface _glfw_wp_tearing_control_manager_v1_interface
+#define wp_tearing_control_v1_interface _glfw_wp_tearing_control_v1_interface
 
 #define GLFW_WAYLAND_WINDOW_STATE         _GLFWwindowWayland  wl;
 #define GLFW_WAYLAND_LIBRARY_WINDOW_STATE _GLFWlibraryWayland wl;
@@ -351,6 +357,20 @@ typedef struct _GLFWfallbackEdgeWayland
     struct wp_viewport*         viewport;
 } _GLFWfallbackEdgeWayland;
 
+// A buffer sub-allocated from the shared memory arena
+//
+typedef struct _GLFWshmBufferWayland
+{
+    struct _GLFWshmBufferWayland* next;
+    struct wl_buffer*           handle;
+    size_t                      offset;
+    size_t                      size;
+    // Whether the compositor may still be reading the buffer
+    GLFWbool                    busy;
+    // Whether the owner no longer needs the buffer
+    GLFWbool                    orphaned;
+} _GLFWshmBufferWayland;
+
 typedef struct _GLFWofferWayland
 {
     struct wl_data_offer*       offer;
@@ -358,6 +378,15 @@ typedef struct _GLFWofferWayland
     GLFWbool                    text_uri_list;
 } _GLFWofferWayland;
 
+// A compiled keymap and the hash of the keymap string it was compiled from
+//
+typedef struct _GLFWkeymapWayland
+{
+    uint64_t                    hash;
+    size_t                      size;
+    struct xkb_keymap*          keymap;
+} _GLFWkeymapWayland;
+
 typedef struct _GLFWscaleWayland
 {
     struct wl_output*           output;
@@ -377,15 +406,47 @@ typedef struct _GLFWwindowWayland
     GLFWbool                    transparent;
     GLFWbool                    scaleFramebuffer;
     struct wl_surface*          surface;
+    // Sync point after the initial configure event, until it is received
+    struct wl_callback*         configureSync;
+    // Whether a Vulkan surface has been created for the window
+    GLFWbool                    vulkanSurface;
+    // Queue for the events the thread presenting the window waits for, i.e.
+    // frame callbacks, buffer releases and presentation feedback
+    struct wl_event_queue*      queue;
+    // Surface wrapper whose frame callbacks are sent to the window queue
+    struct wl_surface*          wrapper;
 
     struct {
-        struct wl_event_queue*  queue;
         struct wl_egl_window*   window;
         struct wl_callback*     callback;
-        struct wl_surface*      wrapper;
         int                     interval;
+        // Whether the next swap does not wait for a frame callback
+        GLFWbool                skipWait;
+        // Lets the compositor flip asynchronously when the interval is zero
+        struct wp_tearing_control_v1* tearingControl;
     } egl;
 
+    // Shared memory for the window pixel buffer, with room for a third buffer
+    // that is only created if the compositor holds on to both of the others
+    struct {
+        struct wl_shm_pool*     pool;
+        unsigned char*          data;
+        size_t                  size;
+        int                     width, height;
+        struct {
+            struct wl_buffer*   handle;
+            GLFWbool            busy;
+        } buffers[3];
+        int                     count;
+        int                     back;
+    } pixels;
+
+    // The sub-surface of a window layer and its position within the parent
+    struct {
+        struct wl_subsurface*   subsurface;
+        int                     xpos, ypos;
+    } layer;
+
     struct {
         int                     width, height;
         GLFWbool                maximized;
@@ -419,6 +480,9 @@ typedef struct _GLFWwindowWayland
     struct wp_viewport*             scalingViewport;
     uint32_t                        scalingNumerator;
     struct wp_fractional_scale_v1*  fractionalScale;
+    // The fraction of the framebuffer size that is rendered and then upscaled
+    // by the compositor through the scaling viewport
+    float                           renderScale;
 
     struct zwp_relative_pointer_v1* relativePointer;
     struct zwp_locked_pointer_v1*   lockedPointer;
@@ -427,9 +491,17 @@ typedef struct _GLFWwindowWayland
     struct zwp_idle_inhibitor_v1*   idleInhibitor;
     struct xdg_activation_token_v1* activationToken;
 
+    // Outstanding presentation feedback, indexed by frame number
+    struct {
+        // Presentation wrapper whose feedback is sent to the window queue
+        struct wp_presentation*     wrapper;
+        struct wp_presentation_feedback* feedbacks[4];
+        uint64_t                    frames[4];
+    } presentation;
+
     struct {
         GLFWbool                    decorations;
-        struct wl_buffer*           buffer;
+        _GLFWshmBufferWayland*      buffer;
         _GLFWfallbackEdgeWayland    top, left, right, bottom;
         double                      pointerX, pointerY;
         uint32_t                    buttonPressSerial;
@@ -443,6 +515,8 @@ typedef struct _GLFWlibraryWayland
 {
     struct wl_display*          display;
     struct wl_registry*         registry;
+    // Sync point after the initial events of the bound globals, until received
+    struct wl_callback*         initialSync;
     struct wl_compositor*       compositor;
     struct wl_subcompositor*    subcompositor;
     struct wl_shm*              shm;
@@ -459,6 +533,11 @@ typedef struct _GLFWlibraryWayland
     struct zwp_idle_inhibit_manager_v1*     idleInhibitManager;
     struct xdg_activation_v1*               activationManager;
     struct wp_fractional_scale_manager_v1*  fractionalScaleManager;
+    struct wp_presentation*                 presentation;
+    uint32_t                                presentationClock;
+    struct wp_cursor_shape_manager_v1*      cursorShapeManager;
+    struct wp_cursor_shape_device_v1*       cursorShapeDevice;
+    struct wp_tearing_control_manager_v1*   tearingControlManager;
 
     _GLFWofferWayland*          offers;
     unsigned int                offerCount;
@@ -472,9 +551,20 @@ typedef struct _GLFWlibraryWayland
 
     const char*                 tag;
 
+    // Shared memory file that all GLFW created shm buffers are allocated from
+    struct {
+        int                     fd;
+        struct wl_shm_pool*     pool;
+        unsigned char*          data;
+        size_t                  size;
+        // Allocated buffers, sorted by offset
+        _GLFWshmBufferWayland*  buffers;
+    } shmArena;
+
     struct wl_surface*          pointerSurface;
     struct wl_cursor_theme*     cursorTheme;
     struct wl_cursor_theme*     cursorThemeHiDPI;
+    GLFWbool                    cursorThemeFailed;
     struct wl_surface*          cursorSurface;
     int                         cursorTimerfd;
     uint32_t                    serial;
@@ -486,6 +576,14 @@ typedef struct _GLFWlibraryWayland
     int                         keyRepeatScancode;
 
     char*                       clipboardString;
+
+    // Clipboard transfer in progress, if any, read from a non-blocking pipe
+    struct {
+        int                     fd;
+        char*                   data;
+        size_t                  length, size;
+    } clipboardTransfer;
+
     short int                   keycodes[256];
     short int                   scancodes[GLFW_KEY_LAST + 1];
     char                        keynames[GLFW_KEY_LAST + 1][5];
@@ -510,6 +608,11 @@ typedef struct _GLFWlibraryWayland
         struct xkb_state*       state;
 
         struct xkb_compose_state* composeState;
+        char*                   composeLocale;
+
+        // Recently used keymaps, most recent first, as compositors may send
+        // the same keymap again on every focus change or layout switch
+        _GLFWkeymapWayland      keymaps[4];
 
         xkb_mod_index_t         controlIndex;
         xkb_mod_index_t         altIndex;
@@ -645,10 +748,11 @@ typedef struct _GLFWcursorWayland
 {
     struct wl_cursor*           cursor;
     struct wl_cursor*           cursorHiDPI;
-    struct wl_buffer*           buffer;
+    _GLFWshmBufferWayland*      buffer;
     int                         width, height;
     int                         xhot, yhot;
     int                         currentImage;
+    uint32_t                    shape;
 } _GLFWcursorWayland;
 
 GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform);
@@ -657,6 +761,7 @@ void _glfwTerminateWayland(void);
 
 GLFWbool _glfwCreateWindowWayland(_GLFWwindow* window, const _GLFWwndconfig* wndconfig, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwDestroyWindowWayland(_GLFWwindow* window);
+GLFWbool _glfwCreateOffscreenContextWayland(_GLFWwindow* window, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwSetWindowTitleWayland(_GLFWwindow* window, const char* title);
 void _glfwSetWindowIconWayland(_GLFWwindow* window, int count, const GLFWimage* images);
 void _glfwGetWindowPosWayland(_GLFWwindow* window, int* xpos, int* ypos);
@@ -688,13 +793,16 @@ void _glfwSetWindowFloatingWayland(_GLFWwindow* window, GLFWbool enabled);
 float _glfwGetWindowOpacityWayland(_GLFWwindow* window);
 void _glfwSetWindowOpacityWayland(_GLFWwindow* window, float opacity);
 void _glfwSetWindowMousePassthroughWayland(_GLFWwindow* window, GLFWbool enabled);
+unsigned char* _glfwGetWindowPixelBufferWayland(_GLFWwindow* window, int* width, int* height, int* stride);
+void _glfwPresentPixelBufferWayland(_GLFWwindow* window, const int* rects, int count);
+GLFWbool _glfwSetWindowRenderScaleWayland(_GLFWwindow* window, float scale);
 
 void _glfwSetRawMouseMotionWayland(_GLFWwindow* window, GLFWbool enabled);
 GLFWbool _glfwRawMouseMotionSupportedWayland(void);
 
 void _glfwPollEventsWayland(void);
 void _glfwWaitEventsWayland(void);
-void _glfwWaitEventsTimeoutWayland(double timeout);
+void _glfwWaitEventsUntilWayland(uint64_t deadline);
 void _glfwPostEmptyEventWayland(void);
 
 void _glfwGetCursorPosWayland(_GLFWwindow* window, double* xpos, double* ypos);
@@ -708,6 +816,7 @@ void _glfwDestroyCursorWayland(_GLFWcursor* cursor);
 void _glfwSetCursorWayland(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringWayland(const char* string);
 const char* _glfwGetClipboardStringWayland(void);
+void _glfwRequestClipboardStringWayland(_GLFWwindow* window);
 
 EGLenum _glfwGetEGLPlatformWayland(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayWayland(void);
@@ -732,5 +841,12 @@ void _glfwUpdateBufferScaleFromOutputsWayland(_GLFWwindow* window);
 void _glfwAddSeatListenerWayland(struct wl_seat* seat);
 void _glfwAddDataDeviceListenerWayland(struct wl_data_device* device);
 
+GLFWbool _glfwWaitForCallbackWayland(struct wl_callback** callback);
+GLFWbool _glfwLoadCursorThemeWayland(void);
+GLFWbool _glfwAwaitConfigureWayland(_GLFWwindow* window);
 GLFWbool _glfwWaitForEGLFrameWayland(_GLFWwindow* window);
+void _glfwSetSwapIntervalWayland(_GLFWwindow* window, int interval);
+void _glfwRequestPresentationFeedbackWayland(_GLFWwindow* window);
+void _glfwTerminateShmArenaWayland(void);
+GLFWbool _glfwGetFrameTimingsWayland(_GLFWwindow* window);
 
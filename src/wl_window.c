@@ -42,6 +42,7 @@
 #include <sys/mman.h>
 #include <sys/timerfd.h>
 #include <poll.h>
+#include <time.h>
 #include <linux/input-event-codes.h>
 
 #include "wayland-client-protocol.h"
@@ -53,6 +54,9 @@
 #include "xdg-activation-v1-client-protocol.h"
 #include "idle-inhibit-unstable-v1-client-protocol.h"
 #include "fractional-scale-v1-client-protocol.h"
+#include "presentation-time-client-protocol.h"
+#include "cursor-shape-v1-client-protocol.h"
+#include "tearing-control-v1-client-protocol.h"
 
 #define GLFW_BORDER_SIZE    4
 #define GLFW_CAPTION_HEIGHT 24
@@ -74,6 +78,20 @@ static int createTmpfileCloexec(char* tmpname)
     return fd;
 }
 
+// Makes sure the specified file is at least the specified size
+//
+static int allocateFileSpace(int fd, off_t size)
+{
+#if defined(SHM_ANON)
+    // posix_fallocate does not work on SHM descriptors
+    if (ftruncate(fd, size) != 0)
+        return errno;
+    return 0;
+#else
+    return posix_fallocate(fd, 0, size);
+#endif
+}
+
 /*
  * Create a new, unique, anonymous file of the given size, and
  * return the file descriptor for it. The file descriptor is set
@@ -136,12 +154,7 @@ static int createAnonymousFile(off_t size)
             return -1;
     }
 
-#if defined(SHM_ANON)
-    // posix_fallocate does not work on SHM descriptors
-    ret = ftruncate(fd, size);
-#else
-    ret = posix_fallocate(fd, 0, size);
-#endif
+    ret = allocateFileSpace(fd, size);
     if (ret != 0)
     {
         close(fd);
@@ -151,35 +164,124 @@ static int createAnonymousFile(off_t size)
     return fd;
 }
 
-static struct wl_buffer* createShmBuffer(const GLFWimage* image)
+// Grows the shared memory arena to at least the specified size
+//
+static GLFWbool growShmArena(size_t size)
 {
-    const int stride = image->width * 4;
-    const int length = image->width * image->height * 4;
+    // NOTE: The arena starts big enough for a few cursors and is then doubled,
+    //       so that most buffers are allocated without any syscalls
+    size_t newSize = 64 * 1024;
+    while (newSize <= _glfw.wl.shmArena.size || newSize < size)
+        newSize *= 2;
 
-    const int fd = createAnonymousFile(length);
-    if (fd < 0)
+    if (!_glfw.wl.shmArena.pool)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "Wayland: Failed to create buffer file of size %d: %s",
-                        length, strerror(errno));
-        return NULL;
+        _glfw.wl.shmArena.fd = createAnonymousFile(newSize);
+        if (_glfw.wl.shmArena.fd < 0)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Wayland: Failed to create buffer file of size %zu: %s",
+                            newSize, strerror(errno));
+            return GLFW_FALSE;
+        }
+    }
+    else
+    {
+        const int error = allocateFileSpace(_glfw.wl.shmArena.fd, newSize);
+        if (error)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Wayland: Failed to grow buffer file to size %zu: %s",
+                            newSize, strerror(error));
+            return GLFW_FALSE;
+        }
     }
 
-    void* data = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    void* data = mmap(NULL, newSize, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      _glfw.wl.shmArena.fd, 0);
     if (data == MAP_FAILED)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "Wayland: Failed to map file: %s", strerror(errno));
-        close(fd);
-        return NULL;
+
+        if (!_glfw.wl.shmArena.pool)
+            close(_glfw.wl.shmArena.fd);
+
+        return GLFW_FALSE;
     }
 
-    struct wl_shm_pool* pool = wl_shm_create_pool(_glfw.wl.shm, fd, length);
+    if (_glfw.wl.shmArena.pool)
+    {
+        munmap(_glfw.wl.shmArena.data, _glfw.wl.shmArena.size);
+        wl_shm_pool_resize(_glfw.wl.shmArena.pool, (int32_t) newSize);
+    }
+    else
+    {
+        _glfw.wl.shmArena.pool = wl_shm_create_pool(_glfw.wl.shm,
+                                                    _glfw.wl.shmArena.fd,
+                                                    (int32_t) newSize);
+    }
 
-    close(fd);
+    _glfw.wl.shmArena.data = data;
+    _glfw.wl.shmArena.size = newSize;
+    return GLFW_TRUE;
+}
+
+static void destroyShmBufferNow(_GLFWshmBufferWayland* buffer)
+{
+    _GLFWshmBufferWayland** prev = &_glfw.wl.shmArena.buffers;
+    while (*prev != buffer)
+        prev = &((*prev)->next);
+
+    *prev = buffer->next;
+
+    wl_buffer_destroy(buffer->handle);
+    _glfw_free(buffer);
+}
+
+static void bufferHandleRelease(void* userData, struct wl_buffer* handle)
+{
+    _GLFWshmBufferWayland* buffer = userData;
+
+    buffer->busy = GLFW_FALSE;
+
+    if (buffer->orphaned)
+        destroyShmBufferNow(buffer);
+}
+
+static const struct wl_buffer_listener bufferListener =
+{
+    bufferHandleRelease
+};
+
+// Creates an ARGB buffer with the specified image in the shared memory arena
+//
+static _GLFWshmBufferWayland* createShmBuffer(const GLFWimage* image)
+{
+    const int stride = image->width * 4;
+    // NOTE: Buffers are cache line aligned so they never share a line
+    const size_t size = ((size_t) stride * image->height + 63) & ~(size_t) 63;
+    size_t offset = 0;
+
+    // Find the first gap between allocated buffers that is large enough
+    _GLFWshmBufferWayland** prev = &_glfw.wl.shmArena.buffers;
+    while (*prev)
+    {
+        if ((*prev)->offset - offset >= size)
+            break;
+
+        offset = (*prev)->offset + (*prev)->size;
+        prev = &((*prev)->next);
+    }
+
+    if (offset + size > _glfw.wl.shmArena.size)
+    {
+        if (!growShmArena(offset + size))
+            return NULL;
+    }
 
     unsigned char* source = (unsigned char*) image->pixels;
-    unsigned char* target = data;
+    unsigned char* target = _glfw.wl.shmArena.data + offset;
     for (int i = 0;  i < image->width * image->height;  i++, source += 4)
     {
         unsigned int alpha = source[3];
@@ -190,17 +292,42 @@ static struct wl_buffer* createShmBuffer(const GLFWimage* image)
         *target++ = (unsigned char) alpha;
     }
 
-    struct wl_buffer* buffer =
-        wl_shm_pool_create_buffer(pool, 0,
-                                  image->width,
-                                  image->height,
-                                  stride, WL_SHM_FORMAT_ARGB8888);
-    munmap(data, length);
-    wl_shm_pool_destroy(pool);
+    _GLFWshmBufferWayland* buffer = _glfw_calloc(1, sizeof(_GLFWshmBufferWayland));
+    buffer->offset = offset;
+    buffer->size = size;
+    buffer->handle = wl_shm_pool_create_buffer(_glfw.wl.shmArena.pool,
+                                               (int32_t) offset,
+                                               image->width,
+                                               image->height,
+                                               stride, WL_SHM_FORMAT_ARGB8888);
+    wl_buffer_add_listener(buffer->handle, &bufferListener, buffer);
+
+    buffer->next = *prev;
+    *prev = buffer;
 
     return buffer;
 }
 
+// Attaches a shared memory buffer to the specified surface
+//
+static void attachShmBuffer(struct wl_surface* surface,
+                            _GLFWshmBufferWayland* buffer)
+{
+    buffer->busy = GLFW_TRUE;
+    wl_surface_attach(surface, buffer->handle, 0, 0);
+}
+
+// Destroys a shared memory buffer once the compositor has released it, as its
+// memory may otherwise be overwritten while still being displayed
+//
+static void destroyShmBuffer(_GLFWshmBufferWayland* buffer)
+{
+    if (buffer->busy)
+        buffer->orphaned = GLFW_TRUE;
+    else
+        destroyShmBufferNow(buffer);
+}
+
 static void callbackHandleDone(void* userData, struct wl_callback* callback, uint32_t data)
 {
     wl_callback_destroy(callback);
@@ -214,7 +341,7 @@ static const struct wl_callback_listener noopCallbackListener =
 static void createFallbackEdge(_GLFWwindow* window,
                                _GLFWfallbackEdgeWayland* edge,
                                struct wl_surface* parent,
-                               struct wl_buffer* buffer,
+                               _GLFWshmBufferWayland* buffer,
                                int x, int y,
                                int width, int height)
 {
@@ -227,7 +354,7 @@ static void createFallbackEdge(_GLFWwindow* window,
     edge->viewport = wp_viewporter_get_viewport(_glfw.wl.viewporter,
                                                 edge->surface);
     wp_viewport_set_destination(edge->viewport, width, height);
-    wl_surface_attach(edge->surface, buffer, 0, 0);
+    attachShmBuffer(edge->surface, buffer);
 
     struct wl_region* region = wl_compositor_create_region(_glfw.wl.compositor);
     wl_region_add(region, 0, 0, width, height);
@@ -296,47 +423,102 @@ static void destroyFallbackDecorations(_GLFWwindow* window)
     destroyFallbackEdge(&window->wl.fallback.bottom);
 }
 
+// Returns the cursor shape device for the current pointer, creating it if needed
+//
+static struct wp_cursor_shape_device_v1* getCursorShapeDevice(void)
+{
+    if (!_glfw.wl.cursorShapeManager || !_glfw.wl.pointer)
+        return NULL;
+
+    if (!_glfw.wl.cursorShapeDevice)
+    {
+        _glfw.wl.cursorShapeDevice =
+            wp_cursor_shape_manager_v1_get_pointer(_glfw.wl.cursorShapeManager,
+                                                   _glfw.wl.pointer);
+    }
+
+    return _glfw.wl.cursorShapeDevice;
+}
+
 static void updateFallbackDecorationCursor(_GLFWwindow* window, double xpos, double ypos)
 {
     window->wl.fallback.pointerX = xpos;
     window->wl.fallback.pointerY = ypos;
 
     const char* cursorName = "left_ptr";
+    uint32_t shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_DEFAULT;
 
     if (window->resizable)
     {
         if (_glfw.wl.pointerSurface == window->wl.fallback.top.surface)
         {
             if (ypos < GLFW_BORDER_SIZE)
+            {
                 cursorName = "n-resize";
+                shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_N_RESIZE;
+            }
         }
         else if (_glfw.wl.pointerSurface == window->wl.fallback.left.surface)
         {
             if (ypos < GLFW_BORDER_SIZE)
+            {
                 cursorName = "nw-resize";
+                shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_NW_RESIZE;
+            }
             else
+            {
                 cursorName = "w-resize";
+                shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_W_RESIZE;
+            }
         }
         else if (_glfw.wl.pointerSurface == window->wl.fallback.right.surface)
         {
             if (ypos < GLFW_BORDER_SIZE)
+            {
                 cursorName = "ne-resize";
+                shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_NE_RESIZE;
+            }
             else
+            {
                 cursorName = "e-resize";
+                shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_E_RESIZE;
+            }
         }
         else if (_glfw.wl.pointerSurface == window->wl.fallback.bottom.surface)
         {
             if (xpos < GLFW_BORDER_SIZE)
+            {
                 cursorName = "sw-resize";
+                shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_SW_RESIZE;
+            }
             else if (xpos > window->wl.width + GLFW_BORDER_SIZE)
+            {
                 cursorName = "se-resize";
+                shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_SE_RESIZE;
+            }
             else
+            {
                 cursorName = "s-resize";
+                shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_S_RESIZE;
+            }
         }
     }
 
     if (window->wl.fallback.cursorName != cursorName)
     {
+        struct wp_cursor_shape_device_v1* device = getCursorShapeDevice();
+        if (device)
+        {
+            wp_cursor_shape_device_v1_set_shape(device,
+                                                _glfw.wl.pointerEnterSerial,
+                                                shape);
+            window->wl.fallback.cursorName = cursorName;
+            return;
+        }
+
+        if (!_glfwLoadCursorThemeWayland())
+            return;
+
         struct wl_surface* surface = _glfw.wl.cursorSurface;
         struct wl_cursor_theme* theme = _glfw.wl.cursorTheme;
         int scale = 1;
@@ -488,6 +670,14 @@ static void resizeFramebuffer(_GLFWwindow* window)
         window->wl.fbHeight = window->wl.height * window->wl.bufferScale;
     }
 
+    if (window->wl.renderScale < 1.f)
+    {
+        window->wl.fbWidth =
+            _glfw_max((int) (window->wl.fbWidth * window->wl.renderScale + 0.5f), 1);
+        window->wl.fbHeight =
+            _glfw_max((int) (window->wl.fbHeight * window->wl.renderScale + 0.5f), 1);
+    }
+
     if (window->wl.egl.window)
     {
         wl_egl_window_resize(window->wl.egl.window,
@@ -577,7 +767,12 @@ void _glfwUpdateBufferScaleFromOutputsWayland(_GLFWwindow* window)
     if (window->wl.bufferScale != maxScale)
     {
         window->wl.bufferScale = maxScale;
-        wl_surface_set_buffer_scale(window->wl.surface, maxScale);
+
+        // The scaling viewport sets the surface size of a render scaled buffer,
+        // which need not be a multiple of the integer scale
+        if (window->wl.renderScale == 1.f)
+            wl_surface_set_buffer_scale(window->wl.surface, maxScale);
+
         _glfwInputWindowContentScale(window, maxScale, maxScale);
         resizeFramebuffer(window);
 
@@ -965,6 +1160,32 @@ static const struct libdecor_frame_interface libdecorFrameInterface =
     libdecorFrameHandleDismissPopup
 };
 
+static void configureSyncHandleDone(void* userData,
+                                    struct wl_callback* callback,
+                                    uint32_t data)
+{
+    _GLFWwindow* window = userData;
+    wl_callback_destroy(callback);
+    window->wl.configureSync = NULL;
+}
+
+static const struct wl_callback_listener configureSyncListener =
+{
+    configureSyncHandleDone
+};
+
+// Requests a sync point after the initial configure event of the window, to
+// be waited on only once the configured state of the window is needed
+//
+static void requestConfigureSync(_GLFWwindow* window)
+{
+    window->wl.configureSync = wl_display_sync(_glfw.wl.display);
+    wl_callback_add_listener(window->wl.configureSync, &configureSyncListener, window);
+
+    // Flush without blocking so the compositor can start on the window early
+    wl_display_flush(_glfw.wl.display);
+}
+
 static GLFWbool createLibdecorFrame(_GLFWwindow* window)
 {
     // Allow libdecor to finish initialization of itself and its plugin
@@ -1034,7 +1255,7 @@ static GLFWbool createLibdecorFrame(_GLFWwindow* window)
     }
 
     libdecor_frame_map(window->wl.libdecor.frame);
-    wl_display_roundtrip(_glfw.wl.display);
+    requestConfigureSync(window);
     return GLFW_TRUE;
 }
 
@@ -1150,7 +1371,7 @@ static GLFWbool createXdgShellObjects(_GLFWwindow* window)
     updateXdgSizeLimits(window);
 
     wl_surface_commit(window->wl.surface);
-    wl_display_roundtrip(_glfw.wl.display);
+    requestConfigureSync(window);
     return GLFW_TRUE;
 }
 
@@ -1169,6 +1390,9 @@ static void destroyShellObjects(_GLFWwindow* window)
 {
     destroyFallbackDecorations(window);
 
+    if (window->wl.configureSync)
+        wl_callback_destroy(window->wl.configureSync);
+
     if (window->wl.libdecor.frame)
         libdecor_frame_unref(window->wl.libdecor.frame);
 
@@ -1181,6 +1405,7 @@ static void destroyShellObjects(_GLFWwindow* window)
     if (window->wl.xdg.surface)
         xdg_surface_destroy(window->wl.xdg.surface);
 
+    window->wl.configureSync = NULL;
     window->wl.libdecor.frame = NULL;
     window->wl.xdg.decoration = NULL;
     window->wl.xdg.decorationMode = 0;
@@ -1188,6 +1413,30 @@ static void destroyShellObjects(_GLFWwindow* window)
     window->wl.xdg.surface = NULL;
 }
 
+// Makes the surface of a window layer a desynchronized sub-surface of its parent
+//
+static GLFWbool createLayerSubsurface(_GLFWwindow* window, _GLFWwindow* parent)
+{
+    window->wl.layer.subsurface =
+        wl_subcompositor_get_subsurface(_glfw.wl.subcompositor,
+                                        window->wl.surface,
+                                        parent->wl.surface);
+    if (!window->wl.layer.subsurface)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create layer sub-surface");
+        return GLFW_FALSE;
+    }
+
+    // The layer is updated independently of the parent surface, but its
+    // position is parent state and applied when the parent is committed
+    wl_subsurface_set_desync(window->wl.layer.subsurface);
+    wl_subsurface_set_position(window->wl.layer.subsurface, 0, 0);
+
+    window->wl.visible = GLFW_TRUE;
+    return GLFW_TRUE;
+}
+
 static GLFWbool createNativeSurface(_GLFWwindow* window,
                                     const _GLFWwndconfig* wndconfig,
                                     const _GLFWfbconfig* fbconfig)
@@ -1204,6 +1453,24 @@ static GLFWbool createNativeSurface(_GLFWwindow* window,
                             &surfaceListener,
                             window);
 
+    window->wl.queue = wl_display_create_queue(_glfw.wl.display);
+    if (!window->wl.queue)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create window event queue");
+        return GLFW_FALSE;
+    }
+
+    window->wl.wrapper = wl_proxy_create_wrapper(window->wl.surface);
+    if (!window->wl.wrapper)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create surface wrapper");
+        return GLFW_FALSE;
+    }
+
+    wl_proxy_set_queue((struct wl_proxy*) window->wl.wrapper, window->wl.queue);
+
     window->wl.width = wndconfig->width;
     window->wl.height = wndconfig->height;
     window->wl.fbWidth = wndconfig->width;
@@ -1212,6 +1479,7 @@ static GLFWbool createNativeSurface(_GLFWwindow* window,
 
     window->wl.bufferScale = 1;
     window->wl.scalingNumerator = 120;
+    window->wl.renderScale = 1.f;
     window->wl.scaleFramebuffer = wndconfig->scaleFramebuffer;
 
     window->wl.maximized = wndconfig->maximized;
@@ -1255,8 +1523,25 @@ static void setCursorImage(_GLFWwindow* window,
     struct wl_surface* surface = _glfw.wl.cursorSurface;
     int scale = 1;
 
+    if (cursorWayland->shape)
+    {
+        struct wp_cursor_shape_device_v1* device = getCursorShapeDevice();
+        if (!device)
+            return;
+
+        // Stop any animation left over from a previous theme cursor
+        timerfd_settime(_glfw.wl.cursorTimerfd, 0, &timer, NULL);
+        wp_cursor_shape_device_v1_set_shape(device,
+                                            _glfw.wl.pointerEnterSerial,
+                                            cursorWayland->shape);
+        return;
+    }
+
     if (!wlCursor)
-        buffer = cursorWayland->buffer;
+    {
+        buffer = cursorWayland->buffer->handle;
+        cursorWayland->buffer->busy = GLFW_TRUE;
+    }
     else
     {
         if (window->wl.bufferScale > 1 && cursorWayland->cursorHiDPI)
@@ -1328,87 +1613,413 @@ static GLFWbool flushDisplay(void)
     return GLFW_TRUE;
 }
 
-static int translateKey(uint32_t scancode)
+// Dispatches events on the default queue until the specified sync callback
+// has completed, which is when its done handler has cleared the pointer
+//
+GLFWbool _glfwWaitForCallbackWayland(struct wl_callback** callback)
 {
-    if (scancode < sizeof(_glfw.wl.keycodes) / sizeof(_glfw.wl.keycodes[0]))
-        return _glfw.wl.keycodes[scancode];
+    while (*callback)
+    {
+        if (wl_display_prepare_read(_glfw.wl.display) != 0)
+        {
+            wl_display_dispatch_pending(_glfw.wl.display);
+            continue;
+        }
 
-    return GLFW_KEY_UNKNOWN;
+        if (!flushDisplay())
+        {
+            wl_display_cancel_read(_glfw.wl.display);
+            return GLFW_FALSE;
+        }
+
+        struct pollfd fd = { wl_display_get_fd(_glfw.wl.display), POLLIN };
+
+        if (!_glfwPollPOSIX(&fd, 1, NULL))
+        {
+            wl_display_cancel_read(_glfw.wl.display);
+            return GLFW_FALSE;
+        }
+
+        if (wl_display_read_events(_glfw.wl.display) == -1)
+            return GLFW_FALSE;
+
+        wl_display_dispatch_pending(_glfw.wl.display);
+    }
+
+    return GLFW_TRUE;
 }
 
-static xkb_keysym_t composeSymbol(xkb_keysym_t sym)
+// Reads and dispatches events for the window queue once, without touching the
+// default queue, so that it can be called by the thread presenting the window
+//
+static GLFWbool dispatchWindowQueue(_GLFWwindow* window, const uint64_t* deadline)
 {
-    if (sym == XKB_KEY_NoSymbol || !_glfw.wl.xkb.composeState)
-        return sym;
-    if (xkb_compose_state_feed(_glfw.wl.xkb.composeState, sym)
-            != XKB_COMPOSE_FEED_ACCEPTED)
-        return sym;
-    switch (xkb_compose_state_get_status(_glfw.wl.xkb.composeState))
+    // NOTE: Preparing fails if the queue already has events, which may have
+    //       been read from the socket by another thread
+    if (wl_display_prepare_read_queue(_glfw.wl.display, window->wl.queue) != 0)
     {
-        case XKB_COMPOSE_COMPOSED:
-            return xkb_compose_state_get_one_sym(_glfw.wl.xkb.composeState);
-        case XKB_COMPOSE_COMPOSING:
-        case XKB_COMPOSE_CANCELLED:
-            return XKB_KEY_NoSymbol;
-        case XKB_COMPOSE_NOTHING:
-        default:
-            return sym;
+        wl_display_dispatch_queue_pending(_glfw.wl.display, window->wl.queue);
+        return GLFW_TRUE;
     }
-}
 
-static void inputText(_GLFWwindow* window, uint32_t scancode)
-{
-    const xkb_keysym_t* keysyms;
-    const xkb_keycode_t keycode = scancode + 8;
+    if (!flushDisplay())
+    {
+        wl_display_cancel_read(_glfw.wl.display);
+        return GLFW_FALSE;
+    }
 
-    if (xkb_state_key_get_syms(_glfw.wl.xkb.state, keycode, &keysyms) == 1)
+    struct pollfd fd = { wl_display_get_fd(_glfw.wl.display), POLLIN };
+
+    if (!_glfwPollPOSIX(&fd, 1, deadline))
     {
-        const xkb_keysym_t keysym = composeSymbol(keysyms[0]);
-        const uint32_t codepoint = xkb_keysym_to_utf32(keysym);
-        if (codepoint != 0)
-        {
-            const int mods = _glfw.wl.xkb.modifiers;
-            const int plain = !(mods & (GLFW_MOD_CONTROL | GLFW_MOD_ALT));
-            _glfwInputChar(window, codepoint, mods, plain);
-        }
+        wl_display_cancel_read(_glfw.wl.display);
+        return GLFW_FALSE;
     }
+
+    if (wl_display_read_events(_glfw.wl.display) == -1)
+        return GLFW_FALSE;
+
+    wl_display_dispatch_queue_pending(_glfw.wl.display, window->wl.queue);
+    return GLFW_TRUE;
 }
 
-static void handleEvents(double* timeout)
+// Waits for the initial configure event of the window if it has been requested
+// but not yet received
+//
+GLFWbool _glfwAwaitConfigureWayland(_GLFWwindow* window)
 {
-#if defined(GLFW_BUILD_LINUX_JOYSTICK)
-    if (_glfw.joysticksInitialized)
-        _glfwDetectJoystickConnectionLinux();
-#endif
+    if (!window->wl.configureSync)
+        return GLFW_TRUE;
 
-    GLFWbool event = GLFW_FALSE;
-    enum { DISPLAY_FD, KEYREPEAT_FD, CURSOR_FD };
-    struct pollfd fds[] =
-    {
-        [DISPLAY_FD] = { wl_display_get_fd(_glfw.wl.display), POLLIN },
-        [KEYREPEAT_FD] = { _glfw.wl.keyRepeatTimerfd, POLLIN },
-        [CURSOR_FD] = { _glfw.wl.cursorTimerfd, POLLIN }
-    };
+    // NOTE: The configure events are on the default queue and their handlers
+    //       call window callbacks, so other threads cannot dispatch them and
+    //       instead fail until the main thread has processed them
+    if (!_glfwIsMainThread())
+        return GLFW_FALSE;
 
-    while (!event)
-    {
-        if (_glfw.wl.libdecor.context)
-        {
-            // Dispatch unconditionally because it also processes non-Wayland events
-            if (libdecor_dispatch(_glfw.wl.libdecor.context, 0) > 0)
-                event = GLFW_TRUE;
-        }
+    return _glfwWaitForCallbackWayland(&window->wl.configureSync);
+}
 
-        while (wl_display_prepare_read(_glfw.wl.display) != 0)
-        {
-            if (wl_display_dispatch_pending(_glfw.wl.display) > 0)
-                event = GLFW_TRUE;
-        }
+static void pixelBufferHandleRelease(void* userData, struct wl_buffer* buffer)
+{
+    GLFWbool* busy = userData;
+    *busy = GLFW_FALSE;
+}
 
-        // If an error other than EAGAIN happens, we have likely been disconnected
-        // from the Wayland session; try to handle that the best we can.
-        if (!flushDisplay())
-        {
+static const struct wl_buffer_listener pixelBufferListener =
+{
+    pixelBufferHandleRelease
+};
+
+static void destroyPixelBuffers(_GLFWwindow* window)
+{
+    for (int i = 0;  i < window->wl.pixels.count;  i++)
+    {
+        if (window->wl.pixels.buffers[i].handle)
+            wl_buffer_destroy(window->wl.pixels.buffers[i].handle);
+
+        window->wl.pixels.buffers[i].handle = NULL;
+        window->wl.pixels.buffers[i].busy = GLFW_FALSE;
+    }
+
+    if (window->wl.pixels.pool)
+        wl_shm_pool_destroy(window->wl.pixels.pool);
+
+    if (window->wl.pixels.data)
+        munmap(window->wl.pixels.data, window->wl.pixels.size);
+
+    window->wl.pixels.pool = NULL;
+    window->wl.pixels.data = NULL;
+    window->wl.pixels.size = 0;
+    window->wl.pixels.width = 0;
+    window->wl.pixels.height = 0;
+    window->wl.pixels.count = 0;
+}
+
+// Creates the next buffer in the shared memory pool of the window, with its
+// release events delivered to the pixel buffer queue of the window
+//
+static void createPixelBuffer(_GLFWwindow* window)
+{
+    const int index = window->wl.pixels.count++;
+    const int stride = window->wl.pixels.width * 4;
+    const size_t length = (size_t) stride * window->wl.pixels.height;
+    const uint32_t format = window->wl.transparent ?
+        WL_SHM_FORMAT_ARGB8888 : WL_SHM_FORMAT_XRGB8888;
+
+    window->wl.pixels.buffers[index].handle =
+        wl_shm_pool_create_buffer(window->wl.pixels.pool,
+                                  (int32_t) (index * length),
+                                  window->wl.pixels.width,
+                                  window->wl.pixels.height,
+                                  stride, format);
+    wl_buffer_add_listener(window->wl.pixels.buffers[index].handle,
+                           &pixelBufferListener,
+                           &window->wl.pixels.buffers[index].busy);
+}
+
+// Creates a shared memory pool for the pixel buffers of the window and a pair
+// of buffers in it
+//
+static GLFWbool createPixelBuffers(_GLFWwindow* window, int width, int height)
+{
+    const int stride = width * 4;
+    const size_t length = (size_t) stride * height;
+    // NOTE: Pages of the file are only allocated once they are written, so the
+    //       room for the third buffer costs nothing until it is used
+    const size_t size = length * 3;
+
+    const int fd = createAnonymousFile(size);
+    if (fd < 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create buffer file of size %zu: %s",
+                        size, strerror(errno));
+        return GLFW_FALSE;
+    }
+
+    void* data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to map file: %s", strerror(errno));
+        close(fd);
+        return GLFW_FALSE;
+    }
+
+    struct wl_shm* wrapper = wl_proxy_create_wrapper(_glfw.wl.shm);
+    wl_proxy_set_queue((struct wl_proxy*) wrapper, window->wl.queue);
+    window->wl.pixels.pool = wl_shm_create_pool(wrapper, fd, (int32_t) size);
+    wl_proxy_wrapper_destroy(wrapper);
+    close(fd);
+
+    window->wl.pixels.data = data;
+    window->wl.pixels.size = size;
+    window->wl.pixels.width = width;
+    window->wl.pixels.height = height;
+    window->wl.pixels.back = 0;
+
+    createPixelBuffer(window);
+    createPixelBuffer(window);
+    return GLFW_TRUE;
+}
+
+// Returns the index of a pixel buffer of the window that the compositor is not
+// reading, creating the third buffer or waiting for a release if needed
+//
+static int acquirePixelBuffer(_GLFWwindow* window)
+{
+    const int maxCount = sizeof(window->wl.pixels.buffers) /
+                         sizeof(window->wl.pixels.buffers[0]);
+
+    for (;;)
+    {
+        for (int i = 0;  i < window->wl.pixels.count;  i++)
+        {
+            if (!window->wl.pixels.buffers[i].busy)
+                return i;
+        }
+
+        if (window->wl.pixels.count < maxCount)
+        {
+            createPixelBuffer(window);
+            return window->wl.pixels.count - 1;
+        }
+
+        // NOTE: A buffer is never handed out while the compositor holds it, as
+        //       it may still be reading from it
+        if (!dispatchWindowQueue(window, NULL))
+            return -1;
+    }
+}
+
+static int translateKey(uint32_t scancode)
+{
+    if (scancode < sizeof(_glfw.wl.keycodes) / sizeof(_glfw.wl.keycodes[0]))
+        return _glfw.wl.keycodes[scancode];
+
+    return GLFW_KEY_UNKNOWN;
+}
+
+static xkb_keysym_t composeSymbol(xkb_keysym_t sym)
+{
+    if (sym == XKB_KEY_NoSymbol || !_glfw.wl.xkb.composeState)
+        return sym;
+    if (xkb_compose_state_feed(_glfw.wl.xkb.composeState, sym)
+            != XKB_COMPOSE_FEED_ACCEPTED)
+        return sym;
+    switch (xkb_compose_state_get_status(_glfw.wl.xkb.composeState))
+    {
+        case XKB_COMPOSE_COMPOSED:
+            return xkb_compose_state_get_one_sym(_glfw.wl.xkb.composeState);
+        case XKB_COMPOSE_COMPOSING:
+        case XKB_COMPOSE_CANCELLED:
+            return XKB_KEY_NoSymbol;
+        case XKB_COMPOSE_NOTHING:
+        default:
+            return sym;
+    }
+}
+
+static void inputText(_GLFWwindow* window, uint32_t scancode)
+{
+    const xkb_keysym_t* keysyms;
+    const xkb_keycode_t keycode = scancode + 8;
+
+    if (xkb_state_key_get_syms(_glfw.wl.xkb.state, keycode, &keysyms) == 1)
+    {
+        const xkb_keysym_t keysym = composeSymbol(keysyms[0]);
+        const uint32_t codepoint = xkb_keysym_to_utf32(keysym);
+        if (codepoint != 0)
+        {
+            const int mods = _glfw.wl.xkb.modifiers;
+            const int plain = !(mods & (GLFW_MOD_CONTROL | GLFW_MOD_ALT));
+            _glfwInputChar(window, codepoint, mods, plain);
+        }
+    }
+}
+
+// Delivers the result of a clipboard transfer to every window waiting for one
+//
+static void deliverClipboardString(const char* string)
+{
+    // Callbacks may destroy windows or make new requests, so the window list
+    // is searched again after each one
+    while (_glfw.wl.clipboardTransfer.fd == -1)
+    {
+        _GLFWwindow* window = _glfw.windowListHead;
+        while (window && !window->clipboardRequest)
+            window = window->next;
+
+        if (!window)
+            break;
+
+        _glfwInputClipboardString(window, string);
+    }
+}
+
+// Ends the clipboard transfer in progress and delivers its result
+//
+static void finishClipboardTransfer(GLFWbool succeeded)
+{
+    char* string = NULL;
+
+    if (succeeded)
+    {
+        if (_glfw.wl.clipboardTransfer.data)
+            string = _glfw.wl.clipboardTransfer.data;
+        else
+            string = _glfw_strdup("");
+    }
+    else
+        _glfw_free(_glfw.wl.clipboardTransfer.data);
+
+    close(_glfw.wl.clipboardTransfer.fd);
+    _glfw.wl.clipboardTransfer.fd = -1;
+    _glfw.wl.clipboardTransfer.data = NULL;
+    _glfw.wl.clipboardTransfer.length = 0;
+    _glfw.wl.clipboardTransfer.size = 0;
+
+    deliverClipboardString(string);
+    _glfw_free(string);
+}
+
+// Reads whatever is available from the clipboard transfer pipe, finishing the
+// transfer when the source has written all of its data
+//
+static GLFWbool readClipboardTransfer(void)
+{
+    for (;;)
+    {
+        const size_t required = _glfw.wl.clipboardTransfer.length + 4096 + 1;
+        if (required > _glfw.wl.clipboardTransfer.size)
+        {
+            size_t size = _glfw.wl.clipboardTransfer.size;
+            if (!size)
+                size = 4096 * 2;
+            while (size < required)
+                size *= 2;
+
+            char* longer = _glfw_realloc(_glfw.wl.clipboardTransfer.data, size);
+            if (!longer)
+            {
+                _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+                finishClipboardTransfer(GLFW_FALSE);
+                return GLFW_TRUE;
+            }
+
+            _glfw.wl.clipboardTransfer.data = longer;
+            _glfw.wl.clipboardTransfer.size = size;
+        }
+
+        char* end = _glfw.wl.clipboardTransfer.data + _glfw.wl.clipboardTransfer.length;
+        const size_t available =
+            _glfw.wl.clipboardTransfer.size - _glfw.wl.clipboardTransfer.length - 1;
+
+        const ssize_t result = read(_glfw.wl.clipboardTransfer.fd, end, available);
+        if (result == 0)
+        {
+            *end = '\0';
+            finishClipboardTransfer(GLFW_TRUE);
+            return GLFW_TRUE;
+        }
+        else if (result == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return GLFW_FALSE;
+
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Wayland: Failed to read from data offer pipe: %s",
+                            strerror(errno));
+            finishClipboardTransfer(GLFW_FALSE);
+            return GLFW_TRUE;
+        }
+
+        _glfw.wl.clipboardTransfer.length += result;
+    }
+}
+
+static void handleEvents(const uint64_t* deadline)
+{
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
+    if (_glfw.joysticksInitialized)
+        _glfwDetectJoystickConnectionLinux();
+#endif
+
+    GLFWbool event = GLFW_FALSE;
+    enum { DISPLAY_FD, KEYREPEAT_FD, CURSOR_FD, CLIPBOARD_FD };
+    struct pollfd fds[] =
+    {
+        [DISPLAY_FD] = { wl_display_get_fd(_glfw.wl.display), POLLIN },
+        [KEYREPEAT_FD] = { _glfw.wl.keyRepeatTimerfd, POLLIN },
+        [CURSOR_FD] = { _glfw.wl.cursorTimerfd, POLLIN },
+        [CLIPBOARD_FD] = { -1, POLLIN }
+    };
+
+    while (!event)
+    {
+        // A clipboard transfer may have been started or finished by a callback
+        fds[CLIPBOARD_FD].fd = _glfw.wl.clipboardTransfer.fd;
+
+        if (_glfw.wl.libdecor.context)
+        {
+            // Dispatch unconditionally because it also processes non-Wayland events
+            if (libdecor_dispatch(_glfw.wl.libdecor.context, 0) > 0)
+                event = GLFW_TRUE;
+        }
+
+        while (wl_display_prepare_read(_glfw.wl.display) != 0)
+        {
+            if (wl_display_dispatch_pending(_glfw.wl.display) > 0)
+                event = GLFW_TRUE;
+        }
+
+        // If an error other than EAGAIN happens, we have likely been disconnected
+        // from the Wayland session; try to handle that the best we can.
+        if (!flushDisplay())
+        {
             wl_display_cancel_read(_glfw.wl.display);
 
             _GLFWwindow* window = _glfw.windowListHead;
@@ -1421,12 +2032,12 @@ static void handleEvents(double* timeout)
             return;
         }
 
-        double immediate = 0.0;
+        const uint64_t immediate = 0;
 
         if (event)
-            timeout = &immediate;
+            deadline = &immediate;
 
-        if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), timeout))
+        if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), deadline))
         {
             wl_display_cancel_read(_glfw.wl.display);
             return;
@@ -1472,6 +2083,15 @@ static void handleEvents(double* timeout)
             if (read(_glfw.wl.cursorTimerfd, &repeats, sizeof(repeats)) == 8)
                 incrementCursorImage();
         }
+
+        if (fds[CLIPBOARD_FD].revents & (POLLIN | POLLHUP))
+        {
+            if (fds[CLIPBOARD_FD].fd == _glfw.wl.clipboardTransfer.fd &&
+                readClipboardTransfer())
+            {
+                event = GLFW_TRUE;
+            }
+        }
     }
 }
 
@@ -1819,6 +2439,110 @@ static const struct wl_pointer_listener pointerListener =
     pointerHandleAxisValue120
 };
 
+// Returns the compiled keymap for the specified keymap string, only compiling
+// it if it is not one of the recently used keymaps
+//
+static struct xkb_keymap* acquireKeymap(const char* string, size_t size)
+{
+    _GLFWkeymapWayland* keymaps = _glfw.wl.xkb.keymaps;
+    const size_t count = sizeof(_glfw.wl.xkb.keymaps) / sizeof(_glfw.wl.xkb.keymaps[0]);
+    size_t index;
+
+    // This is the 64-bit FNV-1a hash, which is fast to compute and good enough
+    // to tell apart the handful of keymaps a compositor will send
+    uint64_t hash = 14695981039346656037u;
+    for (size_t i = 0;  i < size;  i++)
+    {
+        hash ^= (unsigned char) string[i];
+        hash *= 1099511628211u;
+    }
+
+    for (index = 0;  index < count;  index++)
+    {
+        if (keymaps[index].keymap &&
+            keymaps[index].hash == hash &&
+            keymaps[index].size == size)
+        {
+            break;
+        }
+    }
+
+    if (index == count)
+    {
+        struct xkb_keymap* keymap =
+            xkb_keymap_new_from_string(_glfw.wl.xkb.context,
+                                       string,
+                                       XKB_KEYMAP_FORMAT_TEXT_V1,
+                                       XKB_KEYMAP_COMPILE_NO_FLAGS);
+        if (!keymap)
+            return NULL;
+
+        // Replace the least recently used keymap, which stays alive for as
+        // long as any XKB state still references it
+        index = count - 1;
+        if (keymaps[index].keymap)
+            xkb_keymap_unref(keymaps[index].keymap);
+
+        keymaps[index].hash = hash;
+        keymaps[index].size = size;
+        keymaps[index].keymap = keymap;
+    }
+
+    const _GLFWkeymapWayland entry = keymaps[index];
+    memmove(keymaps + 1, keymaps, index * sizeof(_GLFWkeymapWayland));
+    keymaps[0] = entry;
+
+    return entry.keymap;
+}
+
+// Creates the compose state for the preferred locale, unless it has already
+// been created for that locale
+//
+static void updateComposeState(void)
+{
+    // Look up the preferred locale, falling back to "C" as default.
+    const char* locale = getenv("LC_ALL");
+    if (!locale)
+        locale = getenv("LC_CTYPE");
+    if (!locale)
+        locale = getenv("LANG");
+    if (!locale)
+        locale = "C";
+
+    if (_glfw.wl.xkb.composeLocale &&
+        strcmp(_glfw.wl.xkb.composeLocale, locale) == 0)
+    {
+        return;
+    }
+
+    struct xkb_compose_table* composeTable =
+        xkb_compose_table_new_from_locale(_glfw.wl.xkb.context, locale,
+                                          XKB_COMPOSE_COMPILE_NO_FLAGS);
+    if (!composeTable)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create XKB compose table");
+        return;
+    }
+
+    struct xkb_compose_state* composeState =
+        xkb_compose_state_new(composeTable, XKB_COMPOSE_STATE_NO_FLAGS);
+    xkb_compose_table_unref(composeTable);
+    if (!composeState)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create XKB compose state");
+        return;
+    }
+
+    if (_glfw.wl.xkb.composeState)
+        xkb_compose_state_unref(_glfw.wl.xkb.composeState);
+
+    _glfw_free(_glfw.wl.xkb.composeLocale);
+    _glfw.wl.xkb.composeState = composeState;
+    _glfw.wl.xkb.composeLocale = _glfw_strdup(locale);
+}
+
 static void keyboardHandleKeymap(void* userData,
                                  struct wl_keyboard* keyboard,
                                  uint32_t format,
@@ -1827,11 +2551,7 @@ static void keyboardHandleKeymap(void* userData,
 {
     struct xkb_keymap* keymap;
     struct xkb_state* state;
-    struct xkb_compose_table* composeTable;
-    struct xkb_compose_state* composeState;
-
     char* mapStr;
-    const char* locale;
 
     if (format != WL_KEYBOARD_KEYMAP_FORMAT_XKB_V1)
     {
@@ -1846,10 +2566,7 @@ static void keyboardHandleKeymap(void* userData,
         return;
     }
 
-    keymap = xkb_keymap_new_from_string(_glfw.wl.xkb.context,
-                                        mapStr,
-                                        XKB_KEYMAP_FORMAT_TEXT_V1,
-                                        XKB_KEYMAP_COMPILE_NO_FLAGS);
+    keymap = acquireKeymap(mapStr, size);
     munmap(mapStr, size);
     close(fd);
 
@@ -1860,45 +2577,21 @@ static void keyboardHandleKeymap(void* userData,
         return;
     }
 
+    updateComposeState();
+
+    // The compositor sends the current modifiers after every keymap, so the
+    // existing state can be kept if the keymap did not change
+    if (keymap == _glfw.wl.xkb.keymap)
+        return;
+
     state = xkb_state_new(keymap);
     if (!state)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "Wayland: Failed to create XKB state");
-        xkb_keymap_unref(keymap);
         return;
     }
 
-    // Look up the preferred locale, falling back to "C" as default.
-    locale = getenv("LC_ALL");
-    if (!locale)
-        locale = getenv("LC_CTYPE");
-    if (!locale)
-        locale = getenv("LANG");
-    if (!locale)
-        locale = "C";
-
-    composeTable =
-        xkb_compose_table_new_from_locale(_glfw.wl.xkb.context, locale,
-                                          XKB_COMPOSE_COMPILE_NO_FLAGS);
-    if (composeTable)
-    {
-        composeState =
-            xkb_compose_state_new(composeTable, XKB_COMPOSE_STATE_NO_FLAGS);
-        xkb_compose_table_unref(composeTable);
-        if (composeState)
-            _glfw.wl.xkb.composeState = composeState;
-        else
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "Wayland: Failed to create XKB compose state");
-    }
-    else
-    {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "Wayland: Failed to create XKB compose table");
-    }
-
-    xkb_keymap_unref(_glfw.wl.xkb.keymap);
     xkb_state_unref(_glfw.wl.xkb.state);
     _glfw.wl.xkb.keymap = keymap;
     _glfw.wl.xkb.state = state;
@@ -2080,6 +2773,12 @@ static void seatHandleCapabilities(void* userData,
     }
     else if (!(caps & WL_SEAT_CAPABILITY_POINTER) && _glfw.wl.pointer)
     {
+        if (_glfw.wl.cursorShapeDevice)
+        {
+            wp_cursor_shape_device_v1_destroy(_glfw.wl.cursorShapeDevice);
+            _glfw.wl.cursorShapeDevice = NULL;
+        }
+
         if (wl_pointer_get_version(_glfw.wl.pointer) >= WL_POINTER_RELEASE_SINCE_VERSION)
             wl_pointer_release(_glfw.wl.pointer);
         else
@@ -2317,16 +3016,93 @@ static const struct xdg_activation_token_v1_listener xdgActivationListener =
     xdgActivationHandleDone
 };
 
-static void callbackHandleFrame(void* userData, struct wl_callback* callback, uint32_t data)
+static void callbackHandleFrame(void* userData, struct wl_callback* callback, uint32_t data)
+{
+    _GLFWwindow* window = userData;
+    wl_callback_destroy(callback);
+    window->wl.egl.callback = NULL;
+}
+
+static const struct wl_callback_listener frameCallbackListener =
+{
+    callbackHandleFrame
+};
+
+// Removes the specified feedback from the window and returns its frame number
+//
+static uint64_t releasePresentationFeedback(_GLFWwindow* window,
+                                            struct wp_presentation_feedback* feedback)
+{
+    uint64_t frame = 0;
+
+    for (int i = 0;  i < 4;  i++)
+    {
+        if (window->wl.presentation.feedbacks[i] == feedback)
+        {
+            frame = window->wl.presentation.frames[i];
+            window->wl.presentation.feedbacks[i] = NULL;
+            break;
+        }
+    }
+
+    wp_presentation_feedback_destroy(feedback);
+    return frame;
+}
+
+static void feedbackHandleSyncOutput(void* userData,
+                                     struct wp_presentation_feedback* feedback,
+                                     struct wl_output* output)
+{
+}
+
+static void feedbackHandlePresented(void* userData,
+                                    struct wp_presentation_feedback* feedback,
+                                    uint32_t secondsHi,
+                                    uint32_t secondsLo,
+                                    uint32_t nanoseconds,
+                                    uint32_t refresh,
+                                    uint32_t sequenceHi,
+                                    uint32_t sequenceLo,
+                                    uint32_t flags)
+{
+    _GLFWwindow* window = userData;
+    const uint64_t frame = releasePresentationFeedback(window, feedback);
+    uint64_t presentTime;
+
+    if (frame <= window->timings.presentedFrame)
+        return;
+
+    // NOTE: Timestamps on other clocks cannot be related to the GLFW timer
+    if (_glfw.wl.presentationClock != CLOCK_MONOTONIC)
+        return;
+
+    const uint64_t seconds = ((uint64_t) secondsHi << 32) | secondsLo;
+    if (!_glfwPlatformConvertMonotonicTime(seconds * 1000000000 + nanoseconds,
+                                           &presentTime))
+    {
+        return;
+    }
+
+    window->timings.presentedFrame = frame;
+    window->timings.presentTime = presentTime;
+    window->timings.refreshInterval =
+        (uint64_t) refresh * _glfwPlatformGetTimerFrequency() / 1000000000;
+
+    if (flags & WP_PRESENTATION_FEEDBACK_KIND_VSYNC)
+        window->timings.vblankTime = presentTime;
+}
+
+static void feedbackHandleDiscarded(void* userData,
+                                    struct wp_presentation_feedback* feedback)
 {
-    _GLFWwindow* window = userData;
-    wl_callback_destroy(callback);
-    window->wl.egl.callback = NULL;
+    releasePresentationFeedback(userData, feedback);
 }
 
-static const struct wl_callback_listener frameCallbackListener =
+static const struct wp_presentation_feedback_listener feedbackListener =
 {
-    callbackHandleFrame
+    feedbackHandleSyncOutput,
+    feedbackHandlePresented,
+    feedbackHandleDiscarded
 };
 
 void _glfwAddSeatListenerWayland(struct wl_seat* seat)
@@ -2341,41 +3117,95 @@ void _glfwAddDataDeviceListenerWayland(struct wl_data_device* device)
 
 GLFWbool _glfwWaitForEGLFrameWayland(_GLFWwindow* window)
 {
-    double timeout = 0.02;
+    const uint64_t deadline = _glfwPlatformGetTimerValue() +
+        _glfwPlatformGetTimerFrequency() / 50;
 
     while (window->wl.egl.callback)
     {
-        if (wl_display_prepare_read_queue(_glfw.wl.display, window->wl.egl.queue) != 0)
-        {
-            wl_display_dispatch_queue_pending(_glfw.wl.display, window->wl.egl.queue);
-            continue;
-        }
-
-        if (!flushDisplay())
-        {
-            wl_display_cancel_read(_glfw.wl.display);
-            return GLFW_FALSE;
-        }
-
-        struct pollfd fd = { wl_display_get_fd(_glfw.wl.display), POLLIN };
-
-        if (!_glfwPollPOSIX(&fd, 1, &timeout))
-        {
-            wl_display_cancel_read(_glfw.wl.display);
+        // NOTE: Events for other queues are read here but only dispatched by
+        //       the next event processing, as their callbacks may destroy the
+        //       window or change the current context
+        if (!dispatchWindowQueue(window, &deadline))
             return GLFW_FALSE;
-        }
-
-        wl_display_read_events(_glfw.wl.display);
-        wl_display_dispatch_queue_pending(_glfw.wl.display, window->wl.egl.queue);
     }
 
-    window->wl.egl.callback = wl_surface_frame(window->wl.egl.wrapper);
+    window->wl.egl.callback = wl_surface_frame(window->wl.wrapper);
     wl_callback_add_listener(window->wl.egl.callback, &frameCallbackListener, window);
 
     // If the window is hidden when the wait is over then don't swap
     return window->wl.visible;
 }
 
+void _glfwSetSwapIntervalWayland(_GLFWwindow* window, int interval)
+{
+    window->wl.egl.interval = interval;
+
+    // The hint is surface state and takes effect with the next buffer swap
+    if (window->wl.egl.tearingControl)
+    {
+        wp_tearing_control_v1_set_presentation_hint(
+            window->wl.egl.tearingControl,
+            interval == 0 ? WP_TEARING_CONTROL_V1_PRESENTATION_HINT_ASYNC
+                          : WP_TEARING_CONTROL_V1_PRESENTATION_HINT_VSYNC);
+    }
+}
+
+void _glfwRequestPresentationFeedbackWayland(_GLFWwindow* window)
+{
+    if (!_glfw.wl.presentation)
+        return;
+
+    if (!window->wl.presentation.wrapper)
+    {
+        window->wl.presentation.wrapper = wl_proxy_create_wrapper(_glfw.wl.presentation);
+        if (!window->wl.presentation.wrapper)
+            return;
+
+        wl_proxy_set_queue((struct wl_proxy*) window->wl.presentation.wrapper,
+                           window->wl.queue);
+    }
+
+    // Handle any feedback that has already been read before it is superseded
+    wl_display_dispatch_queue_pending(_glfw.wl.display, window->wl.queue);
+
+    const uint64_t frame = window->timings.frame;
+    const int index = (int) (frame % 4);
+
+    // Feedback that is still outstanding after this many frames is unlikely to
+    // arrive before it is superseded
+    if (window->wl.presentation.feedbacks[index])
+        wp_presentation_feedback_destroy(window->wl.presentation.feedbacks[index]);
+
+    window->wl.presentation.feedbacks[index] =
+        wp_presentation_feedback(window->wl.presentation.wrapper, window->wl.surface);
+    window->wl.presentation.frames[index] = frame;
+    wp_presentation_feedback_add_listener(window->wl.presentation.feedbacks[index],
+                                          &feedbackListener,
+                                          window);
+}
+
+GLFWbool _glfwGetFrameTimingsWayland(_GLFWwindow* window)
+{
+    // Read any feedback that has arrived without waiting for more
+    const uint64_t deadline = _glfwPlatformGetTimerValue();
+    dispatchWindowQueue(window, &deadline);
+
+    return window->timings.presentedFrame != 0;
+}
+
+void _glfwTerminateShmArenaWayland(void)
+{
+    while (_glfw.wl.shmArena.buffers)
+        destroyShmBufferNow(_glfw.wl.shmArena.buffers);
+
+    if (_glfw.wl.shmArena.pool)
+    {
+        wl_shm_pool_destroy(_glfw.wl.shmArena.pool);
+        munmap(_glfw.wl.shmArena.data, _glfw.wl.shmArena.size);
+        close(_glfw.wl.shmArena.fd);
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -2385,6 +3215,13 @@ GLFWbool _glfwCreateWindowWayland(_GLFWwindow* window,
                                   const _GLFWctxconfig* ctxconfig,
                                   const _GLFWfbconfig* fbconfig)
 {
+    if (wndconfig->parent && !_glfw.wl.subcompositor)
+    {
+        _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                        "Wayland: The compositor does not support window layers");
+        return GLFW_FALSE;
+    }
+
     if (!createNativeSurface(window, wndconfig, fbconfig))
         return GLFW_FALSE;
 
@@ -2403,27 +3240,18 @@ GLFWbool _glfwCreateWindowWayland(_GLFWwindow* window,
                 return GLFW_FALSE;
             }
 
-            window->wl.egl.queue = wl_display_create_queue(_glfw.wl.display);
-            if (!window->wl.egl.queue)
-            {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "Wayland: Failed to create EGL frame queue");
-                return GLFW_FALSE;
-            }
+            window->wl.egl.interval = 1;
 
-            window->wl.egl.wrapper = wl_proxy_create_wrapper(window->wl.surface);
-            if (!window->wl.egl.wrapper)
+            // NOTE: The EGL implementation is not told about the swap interval
+            //       on Wayland, so it has no reason to set its own hint
+            if (wndconfig->wl.allowTearing && _glfw.wl.tearingControlManager)
             {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "Wayland: Failed to create surface wrapper");
-                return GLFW_FALSE;
+                window->wl.egl.tearingControl =
+                    wp_tearing_control_manager_v1_get_tearing_control(
+                        _glfw.wl.tearingControlManager,
+                        window->wl.surface);
             }
 
-            wl_proxy_set_queue((struct wl_proxy*) window->wl.egl.wrapper,
-                               window->wl.egl.queue);
-
-            window->wl.egl.interval = 1;
-
             if (!_glfwInitEGL())
                 return GLFW_FALSE;
             if (!_glfwCreateContextEGL(window, ctxconfig, fbconfig))
@@ -2444,7 +3272,12 @@ GLFWbool _glfwCreateWindowWayland(_GLFWwindow* window,
     if (wndconfig->mousePassthrough)
         _glfwSetWindowMousePassthroughWayland(window, GLFW_TRUE);
 
-    if (window->monitor || wndconfig->visible)
+    if (wndconfig->parent)
+    {
+        if (!createLayerSubsurface(window, wndconfig->parent))
+            return GLFW_FALSE;
+    }
+    else if (window->monitor || wndconfig->visible)
     {
         if (!createShellObjects(window))
             return GLFW_FALSE;
@@ -2478,6 +3311,12 @@ void _glfwDestroyWindowWayland(_GLFWwindow* window)
     if (window->wl.idleInhibitor)
         zwp_idle_inhibitor_v1_destroy(window->wl.idleInhibitor);
 
+    for (int i = 0;  i < 4;  i++)
+    {
+        if (window->wl.presentation.feedbacks[i])
+            wp_presentation_feedback_destroy(window->wl.presentation.feedbacks[i]);
+    }
+
     if (window->wl.relativePointer)
         zwp_relative_pointer_v1_destroy(window->wl.relativePointer);
 
@@ -2493,20 +3332,31 @@ void _glfwDestroyWindowWayland(_GLFWwindow* window)
     destroyShellObjects(window);
 
     if (window->wl.fallback.buffer)
-        wl_buffer_destroy(window->wl.fallback.buffer);
+        destroyShmBuffer(window->wl.fallback.buffer);
+
+    destroyPixelBuffers(window);
 
     if (window->wl.egl.callback)
         wl_callback_destroy(window->wl.egl.callback);
 
-    if (window->wl.egl.wrapper)
-        wl_proxy_wrapper_destroy(window->wl.egl.wrapper);
-
-    if (window->wl.egl.queue)
-        wl_event_queue_destroy(window->wl.egl.queue);
+    if (window->wl.egl.tearingControl)
+        wp_tearing_control_v1_destroy(window->wl.egl.tearingControl);
 
     if (window->wl.egl.window)
         wl_egl_window_destroy(window->wl.egl.window);
 
+    if (window->wl.layer.subsurface)
+        wl_subsurface_destroy(window->wl.layer.subsurface);
+
+    if (window->wl.presentation.wrapper)
+        wl_proxy_wrapper_destroy(window->wl.presentation.wrapper);
+
+    if (window->wl.wrapper)
+        wl_proxy_wrapper_destroy(window->wl.wrapper);
+
+    if (window->wl.queue)
+        wl_event_queue_destroy(window->wl.queue);
+
     if (window->wl.surface)
         wl_surface_destroy(window->wl.surface);
 
@@ -2514,6 +3364,29 @@ void _glfwDestroyWindowWayland(_GLFWwindow* window)
     _glfw_free(window->wl.outputScales);
 }
 
+GLFWbool _glfwCreateOffscreenContextWayland(_GLFWwindow* window,
+                                            const _GLFWctxconfig* ctxconfig,
+                                            const _GLFWfbconfig* fbconfig)
+{
+    if (ctxconfig->source == GLFW_EGL_CONTEXT_API ||
+        ctxconfig->source == GLFW_NATIVE_CONTEXT_API)
+    {
+        if (!_glfwInitEGL())
+            return GLFW_FALSE;
+        if (!_glfwCreateContextEGL(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
+    }
+    else if (ctxconfig->source == GLFW_OSMESA_CONTEXT_API)
+    {
+        if (!_glfwInitOSMesa())
+            return GLFW_FALSE;
+        if (!_glfwCreateContextOSMesa(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
 void _glfwSetWindowTitleWayland(_GLFWwindow* window, const char* title)
 {
     if (window->wl.libdecor.frame)
@@ -2531,6 +3404,16 @@ void _glfwSetWindowIconWayland(_GLFWwindow* window,
 
 void _glfwGetWindowPosWayland(_GLFWwindow* window, int* xpos, int* ypos)
 {
+    if (window->wl.layer.subsurface)
+    {
+        if (xpos)
+            *xpos = window->wl.layer.xpos;
+        if (ypos)
+            *ypos = window->wl.layer.ypos;
+
+        return;
+    }
+
     // A Wayland client is not aware of its position, so just warn and leave it
     // as (0, 0)
 
@@ -2540,6 +3423,16 @@ void _glfwGetWindowPosWayland(_GLFWwindow* window, int* xpos, int* ypos)
 
 void _glfwSetWindowPosWayland(_GLFWwindow* window, int xpos, int ypos)
 {
+    if (window->wl.layer.subsurface)
+    {
+        window->wl.layer.xpos = xpos;
+        window->wl.layer.ypos = ypos;
+
+        wl_subsurface_set_position(window->wl.layer.subsurface, xpos, ypos);
+        wl_surface_commit(window->parent->wl.surface);
+        return;
+    }
+
     // A Wayland client can not set its position, so just warn
 
     _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
@@ -2720,11 +3613,26 @@ void _glfwMaximizeWindowWayland(_GLFWwindow* window)
 
 void _glfwShowWindowWayland(_GLFWwindow* window)
 {
+    if (window->wl.layer.subsurface)
+    {
+        // The layer is mapped again when its next buffer is committed
+        window->wl.visible = GLFW_TRUE;
+        return;
+    }
+
     if (!window->wl.libdecor.frame && !window->wl.xdg.toplevel)
     {
         // NOTE: The XDG surface and role are created here so command-line applications
         //       with off-screen windows do not appear in for example the Unity dock
         createShellObjects(window);
+
+        // NOTE: A Vulkan surface may present as soon as the window is shown,
+        //       which is a protocol error before its first configure event
+        if (window->wl.vulkanSurface && !_glfwAwaitConfigureWayland(window))
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Wayland: Failed to wait for the window to be configured");
+        }
     }
 }
 
@@ -2833,7 +3741,9 @@ GLFWbool _glfwWindowIconifiedWayland(_GLFWwindow* window)
 
 GLFWbool _glfwWindowVisibleWayland(_GLFWwindow* window)
 {
-    return window->wl.visible;
+    // NOTE: A shown window is reported as visible while its first configure
+    //       event is pending, as waiting for it here would call callbacks
+    return window->wl.visible || window->wl.configureSync;
 }
 
 GLFWbool _glfwWindowMaximizedWayland(_GLFWwindow* window)
@@ -2914,6 +3824,125 @@ void _glfwSetWindowMousePassthroughWayland(_GLFWwindow* window, GLFWbool enabled
         wl_surface_set_input_region(window->wl.surface, NULL);
 }
 
+unsigned char* _glfwGetWindowPixelBufferWayland(_GLFWwindow* window,
+                                                int* width, int* height,
+                                                int* stride)
+{
+    if (!_glfwAwaitConfigureWayland(window))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to wait for the window to be configured");
+        return NULL;
+    }
+
+    if (window->wl.pixels.width != window->wl.fbWidth ||
+        window->wl.pixels.height != window->wl.fbHeight)
+    {
+        destroyPixelBuffers(window);
+
+        if (!createPixelBuffers(window, window->wl.fbWidth, window->wl.fbHeight))
+            return NULL;
+    }
+
+    wl_display_dispatch_queue_pending(_glfw.wl.display, window->wl.queue);
+
+    const int back = acquirePixelBuffer(window);
+    if (back == -1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to wait for a pixel buffer to be released");
+        return NULL;
+    }
+
+    window->wl.pixels.back = back;
+
+    const size_t length = window->wl.pixels.size / 3;
+
+    *width = window->wl.pixels.width;
+    *height = window->wl.pixels.height;
+    *stride = window->wl.pixels.width * 4;
+    return window->wl.pixels.data + window->wl.pixels.back * length;
+}
+
+void _glfwPresentPixelBufferWayland(_GLFWwindow* window, const int* rects, int count)
+{
+    // NOTE: A window that was just shown is not mapped until its first
+    //       configure event, so wait for it instead of dropping the frame
+    if (!_glfwAwaitConfigureWayland(window))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to wait for the window to be configured");
+        return;
+    }
+
+    if (!window->wl.pixels.pool || !window->wl.visible)
+        return;
+
+    const int back = window->wl.pixels.back;
+
+    wl_surface_attach(window->wl.surface, window->wl.pixels.buffers[back].handle, 0, 0);
+
+    if (count == 0 ||
+        wl_proxy_get_version((struct wl_proxy*) window->wl.surface) <
+        WL_SURFACE_DAMAGE_BUFFER_SINCE_VERSION)
+    {
+        wl_surface_damage(window->wl.surface, 0, 0, INT32_MAX, INT32_MAX);
+    }
+    else
+    {
+        for (int i = 0;  i < count;  i++)
+        {
+            const int* rect = rects + i * 4;
+            wl_surface_damage_buffer(window->wl.surface,
+                                     rect[0], rect[1], rect[2], rect[3]);
+        }
+    }
+
+    wl_surface_commit(window->wl.surface);
+
+    window->wl.pixels.buffers[back].busy = GLFW_TRUE;
+    flushDisplay();
+}
+
+GLFWbool _glfwSetWindowRenderScaleWayland(_GLFWwindow* window, float scale)
+{
+    if (!_glfw.wl.viewporter)
+    {
+        _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                        "Wayland: The compositor does not support render scaling");
+        return GLFW_FALSE;
+    }
+
+    if (!window->wl.scalingViewport)
+    {
+        window->wl.scalingViewport =
+            wp_viewporter_get_viewport(_glfw.wl.viewporter, window->wl.surface);
+
+        wp_viewport_set_destination(window->wl.scalingViewport,
+                                    window->wl.width,
+                                    window->wl.height);
+    }
+
+    window->wl.renderScale = scale;
+
+    if (!window->wl.fractionalScale &&
+        wl_compositor_get_version(_glfw.wl.compositor) >=
+        WL_SURFACE_SET_BUFFER_SCALE_SINCE_VERSION)
+    {
+        if (scale == 1.f)
+            wl_surface_set_buffer_scale(window->wl.surface, window->wl.bufferScale);
+        else
+            wl_surface_set_buffer_scale(window->wl.surface, 1);
+    }
+
+    resizeFramebuffer(window);
+
+    if (window->wl.visible)
+        _glfwInputWindowDamage(window);
+
+    return GLFW_TRUE;
+}
+
 float _glfwGetWindowOpacityWayland(_GLFWwindow* window)
 {
     return 1.f;
@@ -2937,8 +3966,8 @@ GLFWbool _glfwRawMouseMotionSupportedWayland(void)
 
 void _glfwPollEventsWayland(void)
 {
-    double timeout = 0.0;
-    handleEvents(&timeout);
+    const uint64_t deadline = 0;
+    handleEvents(&deadline);
 }
 
 void _glfwWaitEventsWayland(void)
@@ -2946,9 +3975,9 @@ void _glfwWaitEventsWayland(void)
     handleEvents(NULL);
 }
 
-void _glfwWaitEventsTimeoutWayland(double timeout)
+void _glfwWaitEventsUntilWayland(uint64_t deadline)
 {
-    handleEvents(&timeout);
+    handleEvents(&deadline);
 }
 
 void _glfwPostEmptyEventWayland(void)
@@ -3059,6 +4088,55 @@ GLFWbool _glfwCreateStandardCursorWayland(_GLFWcursor* cursor, int shape)
 {
     const char* name = NULL;
 
+    if (_glfw.wl.cursorShapeManager)
+    {
+        switch (shape)
+        {
+            case GLFW_ARROW_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_DEFAULT;
+                break;
+            case GLFW_IBEAM_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_TEXT;
+                break;
+            case GLFW_CROSSHAIR_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_CROSSHAIR;
+                break;
+            case GLFW_POINTING_HAND_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_POINTER;
+                break;
+            case GLFW_RESIZE_EW_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_EW_RESIZE;
+                break;
+            case GLFW_RESIZE_NS_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_NS_RESIZE;
+                break;
+            case GLFW_RESIZE_NWSE_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_NWSE_RESIZE;
+                break;
+            case GLFW_RESIZE_NESW_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_NESW_RESIZE;
+                break;
+            case GLFW_RESIZE_ALL_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_ALL_SCROLL;
+                break;
+            case GLFW_NOT_ALLOWED_CURSOR:
+                cursor->wl.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_NOT_ALLOWED;
+                break;
+        }
+
+        return GLFW_TRUE;
+    }
+
+    if (_glfw.wl.cursorThemeFailed)
+    {
+        _glfwInputError(GLFW_CURSOR_UNAVAILABLE,
+                        "Wayland: No cursor theme available");
+        return GLFW_FALSE;
+    }
+
+    if (!_glfwLoadCursorThemeWayland())
+        return GLFW_FALSE;
+
     // Try the XDG names first
     switch (shape)
     {
@@ -3159,11 +4237,11 @@ GLFWbool _glfwCreateStandardCursorWayland(_GLFWcursor* cursor, int shape)
 void _glfwDestroyCursorWayland(_GLFWcursor* cursor)
 {
     // If it's a standard cursor we don't need to do anything here
-    if (cursor->wl.cursor)
+    if (cursor->wl.cursor || cursor->wl.shape)
         return;
 
     if (cursor->wl.buffer)
-        wl_buffer_destroy(cursor->wl.buffer);
+        destroyShmBuffer(cursor->wl.buffer);
 }
 
 static void relativePointerHandleRelativeMotion(void* userData,
@@ -3341,8 +4419,17 @@ void _glfwSetCursorWayland(_GLFWwindow* window, _GLFWcursor* cursor)
     {
         if (cursor)
             setCursorImage(window, &cursor->wl);
+        else if (_glfw.wl.cursorShapeManager)
+        {
+            _GLFWcursorWayland cursorWayland = {0};
+            cursorWayland.shape = WP_CURSOR_SHAPE_DEVICE_V1_SHAPE_DEFAULT;
+            setCursorImage(window, &cursorWayland);
+        }
         else
         {
+            if (!_glfwLoadCursorThemeWayland())
+                return;
+
             struct wl_cursor* defaultCursor =
                 wl_cursor_theme_get_cursor(_glfw.wl.cursorTheme, "left_ptr");
             if (!defaultCursor)
@@ -3366,6 +4453,7 @@ void _glfwSetCursorWayland(_GLFWwindow* window, _GLFWcursor* cursor)
                 NULL,
                 0, 0,
                 0, 0,
+                0,
                 0
             };
 
@@ -3499,6 +4587,45 @@ const char* _glfwGetClipboardStringWayland(void)
     return _glfw.wl.clipboardString;
 }
 
+void _glfwRequestClipboardStringWayland(_GLFWwindow* window)
+{
+    // A transfer already in progress will also deliver to this window
+    if (_glfw.wl.clipboardTransfer.fd != -1)
+        return;
+
+    if (!_glfw.wl.selectionOffer)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "Wayland: No clipboard data available");
+        _glfwInputClipboardString(window, NULL);
+        return;
+    }
+
+    if (_glfw.wl.selectionSource)
+    {
+        _glfwInputClipboardString(window, _glfw.wl.clipboardString);
+        return;
+    }
+
+    int fds[2];
+
+    if (pipe2(fds, O_CLOEXEC | O_NONBLOCK) == -1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create pipe for data offer: %s",
+                        strerror(errno));
+        _glfwInputClipboardString(window, NULL);
+        return;
+    }
+
+    wl_data_offer_receive(_glfw.wl.selectionOffer, "text/plain;charset=utf-8", fds[1]);
+    flushDisplay();
+    close(fds[1]);
+
+    // The data is read as it arrives while events are processed
+    _glfw.wl.clipboardTransfer.fd = fds[0];
+}
+
 EGLenum _glfwGetEGLPlatformWayland(EGLint** attribs)
 {
     if (_glfw.egl.EXT_platform_base && _glfw.egl.EXT_platform_wayland)
@@ -3564,6 +4691,15 @@ VkResult _glfwCreateWindowSurfaceWayland(VkInstance instance,
         return VK_ERROR_EXTENSION_NOT_PRESENT;
     }
 
+    // NOTE: Presenting to a surface before its first configure event is
+    //       a protocol error
+    if (!_glfwAwaitConfigureWayland(window))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to wait for the window to be configured before creating a Vulkan surface");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
     memset(&sci, 0, sizeof(sci));
     sci.sType = VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR;
     sci.display = _glfw.wl.display;
@@ -3576,6 +4712,8 @@ VkResult _glfwCreateWindowSurfaceWayland(VkInstance instance,
                         "Wayland: Failed to create Vulkan surface: %s",
                         _glfwGetVulkanResultString(err));
     }
+    else
+        window->wl.vulkanSurface = GLFW_TRUE;
 
     return err;
 }
@@ -906,6 +906,41 @@ static GLFWbool initExtensions(void)
         }
     }
 
+#if defined(__CYGWIN__)
+    _glfw.x11.xshm.handle = _glfwPlatformLoadModule("libXext-6.so");
+#elif defined(__OpenBSD__) || defined(__NetBSD__)
+    _glfw.x11.xshm.handle = _glfwPlatformLoadModule("libXext.so");
+#else
+    _glfw.x11.xshm.handle = _glfwPlatformLoadModule("libXext.so.6");
+#endif
+    if (_glfw.x11.xshm.handle)
+    {
+        _glfw.x11.xshm.QueryExtension = (PFN_XShmQueryExtension)
+            _glfwPlatformGetModuleSymbol(_glfw.x11.xshm.handle, "XShmQueryExtension");
+        _glfw.x11.xshm.GetEventBase = (PFN_XShmGetEventBase)
+            _glfwPlatformGetModuleSymbol(_glfw.x11.xshm.handle, "XShmGetEventBase");
+        _glfw.x11.xshm.Attach = (PFN_XShmAttach)
+            _glfwPlatformGetModuleSymbol(_glfw.x11.xshm.handle, "XShmAttach");
+        _glfw.x11.xshm.Detach = (PFN_XShmDetach)
+            _glfwPlatformGetModuleSymbol(_glfw.x11.xshm.handle, "XShmDetach");
+        _glfw.x11.xshm.CreateImage = (PFN_XShmCreateImage)
+            _glfwPlatformGetModuleSymbol(_glfw.x11.xshm.handle, "XShmCreateImage");
+        _glfw.x11.xshm.PutImage = (PFN_XShmPutImage)
+            _glfwPlatformGetModuleSymbol(_glfw.x11.xshm.handle, "XShmPutImage");
+
+        if (_glfw.x11.xshm.QueryExtension &&
+            _glfw.x11.xshm.GetEventBase &&
+            _glfw.x11.xshm.Attach &&
+            _glfw.x11.xshm.Detach &&
+            _glfw.x11.xshm.CreateImage &&
+            _glfw.x11.xshm.PutImage &&
+            XShmQueryExtension(_glfw.x11.display))
+        {
+            _glfw.x11.xshm.eventBase = XShmGetEventBase(_glfw.x11.display);
+            _glfw.x11.xshm.available = GLFW_TRUE;
+        }
+    }
+
     // Update the key code LUT
     // FIXME: We should listen to XkbMapNotify events to track changes to
     // the keyboard mapping.
@@ -1206,6 +1241,7 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampX11,
         .createWindow = _glfwCreateWindowX11,
         .destroyWindow = _glfwDestroyWindowX11,
+        .createOffscreenContext = _glfwCreateOffscreenContextX11,
         .setWindowTitle = _glfwSetWindowTitleX11,
         .setWindowIcon = _glfwSetWindowIconX11,
         .getWindowPos = _glfwGetWindowPosX11,
@@ -1237,9 +1273,13 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingX11,
         .setWindowOpacity = _glfwSetWindowOpacityX11,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughX11,
+        .getWindowPixelBuffer = _glfwGetWindowPixelBufferX11,
+        .presentPixelBuffer = _glfwPresentPixelBufferX11,
+        .setWindowRenderScale = _glfwSetWindowRenderScaleX11,
+        .requestClipboardString = _glfwRequestClipboardStringX11,
         .pollEvents = _glfwPollEventsX11,
         .waitEvents = _glfwWaitEventsX11,
-        .waitEventsTimeout = _glfwWaitEventsTimeoutX11,
+        .waitEventsUntil = _glfwWaitEventsUntilX11,
         .postEmptyEvent = _glfwPostEmptyEventX11,
         .getEGLPlatform = _glfwGetEGLPlatformX11,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayX11,
@@ -1344,8 +1384,12 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XCreateColormap");
     _glfw.x11.xlib.CreateFontCursor = (PFN_XCreateFontCursor)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XCreateFontCursor");
+    _glfw.x11.xlib.CreateGC = (PFN_XCreateGC)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XCreateGC");
     _glfw.x11.xlib.CreateIC = (PFN_XCreateIC)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XCreateIC");
+    _glfw.x11.xlib.CreateImage = (PFN_XCreateImage)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XCreateImage");
     _glfw.x11.xlib.CreateRegion = (PFN_XCreateRegion)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XCreateRegion");
     _glfw.x11.xlib.CreateWindow = (PFN_XCreateWindow)
@@ -1380,6 +1424,8 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XFreeCursor");
     _glfw.x11.xlib.FreeEventData = (PFN_XFreeEventData)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XFreeEventData");
+    _glfw.x11.xlib.FreeGC = (PFN_XFreeGC)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XFreeGC");
     _glfw.x11.xlib.GetErrorText = (PFN_XGetErrorText)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XGetErrorText");
     _glfw.x11.xlib.GetEventData = (PFN_XGetEventData)
@@ -1408,6 +1454,8 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XGrabPointer");
     _glfw.x11.xlib.IconifyWindow = (PFN_XIconifyWindow)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XIconifyWindow");
+    _glfw.x11.xlib.IfEvent = (PFN_XIfEvent)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XIfEvent");
     _glfw.x11.xlib.InternAtom = (PFN_XInternAtom)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XInternAtom");
     _glfw.x11.xlib.LookupString = (PFN_XLookupString)
@@ -1428,6 +1476,8 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XPeekEvent");
     _glfw.x11.xlib.Pending = (PFN_XPending)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XPending");
+    _glfw.x11.xlib.PutImage = (PFN_XPutImage)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XPutImage");
     _glfw.x11.xlib.QueryExtension = (PFN_XQueryExtension)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XQueryExtension");
     _glfw.x11.xlib.QueryPointer = (PFN_XQueryPointer)
@@ -1604,6 +1654,7 @@ void _glfwTerminateX11(void)
     _glfwPlatformFreeModule(_glfw.x11.xinerama.handle);
     _glfwPlatformFreeModule(_glfw.x11.xrender.handle);
     _glfwPlatformFreeModule(_glfw.x11.xshape.handle);
+    _glfwPlatformFreeModule(_glfw.x11.xshm.handle);
     _glfwPlatformFreeModule(_glfw.x11.vidmode.handle);
     _glfwPlatformFreeModule(_glfw.x11.xi.handle);
     _glfwPlatformFreeModule(_glfw.x11.xlib.handle);
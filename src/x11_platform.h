@@ -50,9 +50,13 @@
 // The Shape extension provides custom window shapes
 #include <X11/extensions/shape.h>
 
+// The MIT-SHM extension provides shared memory window pixel buffers
+#include <X11/extensions/XShm.h>
+
 #define GLX_VENDOR 1
 #define GLX_RGBA_BIT 0x00000001
 #define GLX_WINDOW_BIT 0x00000001
+#define GLX_PBUFFER_BIT 0x00000004
 #define GLX_DRAWABLE_TYPE 0x8010
 #define GLX_RENDER_TYPE 0x8011
 #define GLX_RGBA_TYPE 0x8014
@@ -71,6 +75,9 @@
 #define GLX_ACCUM_ALPHA_SIZE 17
 #define GLX_SAMPLES 0x186a1
 #define GLX_VISUAL_ID 0x800b
+#define GLX_PBUFFER_HEIGHT 0x8040
+#define GLX_PBUFFER_WIDTH 0x8041
+#define GLX_BACK_BUFFER_AGE_EXT 0x20f4
 
 #define GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB 0x20b2
 #define GLX_CONTEXT_DEBUG_BIT_ARB 0x00000001
@@ -92,6 +99,7 @@
 #define GLX_CONTEXT_OPENGL_NO_ERROR_ARB 0x31b3
 
 typedef XID GLXWindow;
+typedef XID GLXPbuffer;
 typedef XID GLXDrawable;
 typedef struct __GLXFBConfig* GLXFBConfig;
 typedef struct __GLXcontext* GLXContext;
@@ -109,7 +117,9 @@ typedef Status (* PFN_XCloseIM)(XIM);
 typedef int (* PFN_XConvertSelection)(Display*,Atom,Atom,Atom,Window,Time);
 typedef Colormap (* PFN_XCreateColormap)(Display*,Window,Visual*,int);
 typedef Cursor (* PFN_XCreateFontCursor)(Display*,unsigned int);
+typedef GC (* PFN_XCreateGC)(Display*,Drawable,unsigned long,XGCValues*);
 typedef XIC (* PFN_XCreateIC)(XIM,...);
+typedef XImage* (* PFN_XCreateImage)(Display*,Visual*,unsigned int,int,int,char*,unsigned int,unsigned int,int,int);
 typedef Region (* PFN_XCreateRegion)(void);
 typedef Window (* PFN_XCreateWindow)(Display*,Window,int,int,unsigned int,unsigned int,unsigned int,int,unsigned int,Visual*,unsigned long,XSetWindowAttributes*);
 typedef int (* PFN_XDefineCursor)(Display*,Window,Cursor);
@@ -127,6 +137,7 @@ typedef int (* PFN_XFree)(void*);
 typedef int (* PFN_XFreeColormap)(Display*,Colormap);
 typedef int (* PFN_XFreeCursor)(Display*,Cursor);
 typedef void (* PFN_XFreeEventData)(Display*,XGenericEventCookie*);
+typedef int (* PFN_XFreeGC)(Display*,GC);
 typedef int (* PFN_XGetErrorText)(Display*,int,char*,int);
 typedef Bool (* PFN_XGetEventData)(Display*,XGenericEventCookie*);
 typedef char* (* PFN_XGetICValues)(XIC,...);
@@ -141,6 +152,7 @@ typedef Status (* PFN_XGetWindowAttributes)(Display*,Window,XWindowAttributes*);
 typedef int (* PFN_XGetWindowProperty)(Display*,Window,Atom,long,long,Bool,Atom,Atom*,int*,unsigned long*,unsigned long*,unsigned char**);
 typedef int (* PFN_XGrabPointer)(Display*,Window,Bool,unsigned int,int,int,Window,Cursor,Time);
 typedef Status (* PFN_XIconifyWindow)(Display*,Window,int);
+typedef int (* PFN_XIfEvent)(Display*,XEvent*,Bool(*)(Display*,XEvent*,XPointer),XPointer);
 typedef Status (* PFN_XInitThreads)(void);
 typedef Atom (* PFN_XInternAtom)(Display*,const char*,Bool);
 typedef int (* PFN_XLookupString)(XKeyEvent*,char*,int,KeySym*,XComposeStatus*);
@@ -153,6 +165,7 @@ typedef Display* (* PFN_XOpenDisplay)(const char*);
 typedef XIM (* PFN_XOpenIM)(Display*,XrmDatabase*,char*,char*);
 typedef int (* PFN_XPeekEvent)(Display*,XEvent*);
 typedef int (* PFN_XPending)(Display*);
+typedef int (* PFN_XPutImage)(Display*,Drawable,GC,XImage*,int,int,int,int,unsigned int,unsigned int);
 typedef Bool (* PFN_XQueryExtension)(Display*,const char*,int*,int*,int*);
 typedef Bool (* PFN_XQueryPointer)(Display*,Window,Window*,Window*,int*,int*,int*,int*,unsigned int*);
 typedef int (* PFN_XRaiseWindow)(Display*,Window);
@@ -211,7 +224,9 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XConvertSelection _glfw.x11.xlib.ConvertSelection
 #define XCreateColormap _glfw.x11.xlib.CreateColormap
 #define XCreateFontCursor _glfw.x11.xlib.CreateFontCursor
+#define XCreateGC _glfw.x11.xlib.CreateGC
 #define XCreateIC _glfw.x11.xlib.CreateIC
+#define XCreateImage _glfw.x11.xlib.CreateImage
 #define XCreateRegion _glfw.x11.xlib.CreateRegion
 #define XCreateWindow _glfw.x11.xlib.CreateWindow
 #define XDefineCursor _glfw.x11.xlib.DefineCursor
@@ -229,6 +244,7 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XFreeColormap _glfw.x11.xlib.FreeColormap
 #define XFreeCursor _glfw.x11.xlib.FreeCursor
 #define XFreeEventData _glfw.x11.xlib.FreeEventData
+#define XFreeGC _glfw.x11.xlib.FreeGC
 #define XGetErrorText _glfw.x11.xlib.GetErrorText
 #define XGetEventData _glfw.x11.xlib.GetEventData
 #define XGetICValues _glfw.x11.xlib.GetICValues
@@ -243,6 +259,7 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XGetWindowProperty _glfw.x11.xlib.GetWindowProperty
 #define XGrabPointer _glfw.x11.xlib.GrabPointer
 #define XIconifyWindow _glfw.x11.xlib.IconifyWindow
+#define XIfEvent _glfw.x11.xlib.IfEvent
 #define XInternAtom _glfw.x11.xlib.InternAtom
 #define XLookupString _glfw.x11.xlib.LookupString
 #define XMapRaised _glfw.x11.xlib.MapRaised
@@ -253,6 +270,7 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XOpenIM _glfw.x11.xlib.OpenIM
 #define XPeekEvent _glfw.x11.xlib.PeekEvent
 #define XPending _glfw.x11.xlib.Pending
+#define XPutImage _glfw.x11.xlib.PutImage
 #define XQueryExtension _glfw.x11.xlib.QueryExtension
 #define XQueryPointer _glfw.x11.xlib.QueryPointer
 #define XRaiseWindow _glfw.x11.xlib.RaiseWindow
@@ -391,6 +409,20 @@ typedef void (* PFN_XShapeCombineMask)(Display*,Window,int,int,int,Pixmap,int);
 #define XShapeCombineRegion _glfw.x11.xshape.ShapeCombineRegion
 #define XShapeCombineMask _glfw.x11.xshape.ShapeCombineMask
 
+typedef Bool (* PFN_XShmQueryExtension)(Display*);
+typedef int (* PFN_XShmGetEventBase)(Display*);
+typedef Bool (* PFN_XShmAttach)(Display*,XShmSegmentInfo*);
+typedef Bool (* PFN_XShmDetach)(Display*,XShmSegmentInfo*);
+typedef XImage* (* PFN_XShmCreateImage)(Display*,Visual*,unsigned int,int,char*,XShmSegmentInfo*,unsigned int,unsigned int);
+typedef Bool (* PFN_XShmPutImage)(Display*,Drawable,GC,XImage*,int,int,int,int,unsigned int,unsigned int,Bool);
+
+#define XShmQueryExtension _glfw.x11.xshm.QueryExtension
+#define XShmGetEventBase _glfw.x11.xshm.GetEventBase
+#define XShmAttach _glfw.x11.xshm.Attach
+#define XShmDetach _glfw.x11.xshm.Detach
+#define XShmCreateImage _glfw.x11.xshm.CreateImage
+#define XShmPutImage _glfw.x11.xshm.PutImage
+
 typedef int (*PFNGLXGETFBCONFIGATTRIBPROC)(Display*,GLXFBConfig,int,int*);
 typedef const char* (*PFNGLXGETCLIENTSTRINGPROC)(Display*,int);
 typedef Bool (*PFNGLXQUERYEXTENSIONPROC)(Display*,int*,int*);
@@ -406,9 +438,14 @@ typedef void (*PFNGLXSWAPINTERVALEXTPROC)(Display*,GLXDrawable,int);
 typedef XVisualInfo* (*PFNGLXGETVISUALFROMFBCONFIGPROC)(Display*,GLXFBConfig);
 typedef GLXWindow (*PFNGLXCREATEWINDOWPROC)(Display*,GLXFBConfig,Window,const int*);
 typedef void (*PFNGLXDESTROYWINDOWPROC)(Display*,GLXWindow);
+typedef GLXPbuffer (*PFNGLXCREATEPBUFFERPROC)(Display*,GLXFBConfig,const int*);
+typedef void (*PFNGLXDESTROYPBUFFERPROC)(Display*,GLXPbuffer);
+typedef void (*PFNGLXQUERYDRAWABLEPROC)(Display*,GLXDrawable,int,unsigned int*);
 
 typedef int (*PFNGLXSWAPINTERVALMESAPROC)(int);
 typedef int (*PFNGLXSWAPINTERVALSGIPROC)(int);
+typedef Bool (*PFNGLXGETSYNCVALUESOMLPROC)(Display*,GLXDrawable,int64_t*,int64_t*,int64_t*);
+typedef Bool (*PFNGLXGETMSCRATEOMLPROC)(Display*,GLXDrawable,int32_t*,int32_t*);
 typedef GLXContext (*PFNGLXCREATECONTEXTATTRIBSARBPROC)(Display*,GLXFBConfig,GLXContext,Bool,const int*);
 
 // libGL.so function pointer typedefs
@@ -425,6 +462,9 @@ typedef GLXContext (*PFNGLXCREATECONTEXTATTRIBSARBPROC)(Display*,GLXFBConfig,GLX
 #define glXGetVisualFromFBConfig _glfw.glx.GetVisualFromFBConfig
 #define glXCreateWindow _glfw.glx.CreateWindow
 #define glXDestroyWindow _glfw.glx.DestroyWindow
+#define glXCreatePbuffer _glfw.glx.CreatePbuffer
+#define glXDestroyPbuffer _glfw.glx.DestroyPbuffer
+#define glXQueryDrawable _glfw.glx.QueryDrawable
 
 typedef VkFlags VkXlibSurfaceCreateFlagsKHR;
 typedef VkFlags VkXcbSurfaceCreateFlagsKHR;
@@ -467,8 +507,10 @@ typedef VkBool32 (APIENTRY *PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR)(Vk
 typedef struct _GLFWcontextGLX
 {
     GLXContext      handle;
+    // The GLXWindow, or the GLXPbuffer of an offscreen context
     GLXWindow       window;
     GLXFBConfig     fbconfig;
+    int64_t         lastSbc;
 } _GLFWcontextGLX;
 
 // GLX-specific global data
@@ -478,6 +520,9 @@ typedef struct _GLFWlibraryGLX
     int             major, minor;
     int             eventBase;
     int             errorBase;
+    _GLFWextensionset extensions;
+    _GLFWfbconfigcache fbconfigs;
+    _GLFWproccache  procs;
 
     void*           handle;
 
@@ -495,6 +540,9 @@ typedef struct _GLFWlibraryGLX
     PFNGLXGETVISUALFROMFBCONFIGPROC     GetVisualFromFBConfig;
     PFNGLXCREATEWINDOWPROC              CreateWindow;
     PFNGLXDESTROYWINDOWPROC             DestroyWindow;
+    PFNGLXCREATEPBUFFERPROC             CreatePbuffer;
+    PFNGLXDESTROYPBUFFERPROC            DestroyPbuffer;
+    PFNGLXQUERYDRAWABLEPROC             QueryDrawable;
 
     // GLX 1.4 and extension functions
     PFNGLXGETPROCADDRESSPROC            GetProcAddress;
@@ -503,6 +551,8 @@ typedef struct _GLFWlibraryGLX
     PFNGLXSWAPINTERVALEXTPROC           SwapIntervalEXT;
     PFNGLXSWAPINTERVALMESAPROC          SwapIntervalMESA;
     PFNGLXCREATECONTEXTATTRIBSARBPROC   CreateContextAttribsARB;
+    PFNGLXGETSYNCVALUESOMLPROC          GetSyncValuesOML;
+    PFNGLXGETMSCRATEOMLPROC             GetMscRateOML;
     bool            SGI_swap_control;
     bool            EXT_swap_control;
     bool            MESA_swap_control;
@@ -515,6 +565,8 @@ typedef struct _GLFWlibraryGLX
     bool            EXT_create_context_es2_profile;
     bool            ARB_create_context_no_error;
     bool            ARB_context_flush_control;
+    bool            OML_sync_control;
+    bool            EXT_buffer_age;
 } _GLFWlibraryGLX;
 
 // X11-specific per-window data
@@ -545,6 +597,25 @@ typedef struct _GLFWwindowX11
     // The time of the last KeyPress event per keycode, for discarding
     // duplicate key events generated for some keys by ibus
     Time            keyPressTimes[256];
+
+    // Window pixel buffer images, double-buffered when MIT-SHM is used
+    struct {
+        GC              gc;
+        GLFWbool        shm;
+        int             width, height;
+        int             back;
+        XImage*         images[2];
+        XShmSegmentInfo segments[2];
+        GLFWbool        busy[2];
+    } pixels;
+
+    // Clipboard transfer in progress, if any
+    struct {
+        Atom            target;
+        GLFWbool        incr;
+        char*           data;
+        size_t          length, size;
+    } clipboard;
 } _GLFWwindowX11;
 
 // X11-specific global data
@@ -656,7 +727,9 @@ typedef struct _GLFWlibraryX11
         PFN_XConvertSelection ConvertSelection;
         PFN_XCreateColormap CreateColormap;
         PFN_XCreateFontCursor CreateFontCursor;
+        PFN_XCreateGC CreateGC;
         PFN_XCreateIC CreateIC;
+        PFN_XCreateImage CreateImage;
         PFN_XCreateRegion CreateRegion;
         PFN_XCreateWindow CreateWindow;
         PFN_XDefineCursor DefineCursor;
@@ -674,6 +747,7 @@ typedef struct _GLFWlibraryX11
         PFN_XFreeColormap FreeColormap;
         PFN_XFreeCursor FreeCursor;
         PFN_XFreeEventData FreeEventData;
+        PFN_XFreeGC FreeGC;
         PFN_XGetErrorText GetErrorText;
         PFN_XGetEventData GetEventData;
         PFN_XGetICValues GetICValues;
@@ -688,6 +762,7 @@ typedef struct _GLFWlibraryX11
         PFN_XGetWindowProperty GetWindowProperty;
         PFN_XGrabPointer GrabPointer;
         PFN_XIconifyWindow IconifyWindow;
+        PFN_XIfEvent IfEvent;
         PFN_XInternAtom InternAtom;
         PFN_XLookupString LookupString;
         PFN_XMapRaised MapRaised;
@@ -698,6 +773,7 @@ typedef struct _GLFWlibraryX11
         PFN_XOpenIM OpenIM;
         PFN_XPeekEvent PeekEvent;
         PFN_XPending Pending;
+        PFN_XPutImage PutImage;
         PFN_XQueryExtension QueryExtension;
         PFN_XQueryPointer QueryPointer;
         PFN_XRaiseWindow RaiseWindow;
@@ -873,6 +949,18 @@ typedef struct _GLFWlibraryX11
         PFN_XShapeQueryVersion QueryVersion;
         PFN_XShapeCombineMask ShapeCombineMask;
     } xshape;
+
+    struct {
+        GLFWbool    available;
+        void*       handle;
+        int         eventBase;
+        PFN_XShmQueryExtension QueryExtension;
+        PFN_XShmGetEventBase GetEventBase;
+        PFN_XShmAttach Attach;
+        PFN_XShmDetach Detach;
+        PFN_XShmCreateImage CreateImage;
+        PFN_XShmPutImage PutImage;
+    } xshm;
 } _GLFWlibraryX11;
 
 // X11-specific per-monitor data
@@ -902,6 +990,7 @@ void _glfwTerminateX11(void);
 
 GLFWbool _glfwCreateWindowX11(_GLFWwindow* window, const _GLFWwndconfig* wndconfig, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwDestroyWindowX11(_GLFWwindow* window);
+GLFWbool _glfwCreateOffscreenContextX11(_GLFWwindow* window, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwSetWindowTitleX11(_GLFWwindow* window, const char* title);
 void _glfwSetWindowIconX11(_GLFWwindow* window, int count, const GLFWimage* images);
 void _glfwGetWindowPosX11(_GLFWwindow* window, int* xpos, int* ypos);
@@ -933,13 +1022,16 @@ void _glfwSetWindowFloatingX11(_GLFWwindow* window, GLFWbool enabled);
 float _glfwGetWindowOpacityX11(_GLFWwindow* window);
 void _glfwSetWindowOpacityX11(_GLFWwindow* window, float opacity);
 void _glfwSetWindowMousePassthroughX11(_GLFWwindow* window, GLFWbool enabled);
+unsigned char* _glfwGetWindowPixelBufferX11(_GLFWwindow* window, int* width, int* height, int* stride);
+void _glfwPresentPixelBufferX11(_GLFWwindow* window, const int* rects, int count);
+GLFWbool _glfwSetWindowRenderScaleX11(_GLFWwindow* window, float scale);
 
 void _glfwSetRawMouseMotionX11(_GLFWwindow *window, GLFWbool enabled);
 GLFWbool _glfwRawMouseMotionSupportedX11(void);
 
 void _glfwPollEventsX11(void);
 void _glfwWaitEventsX11(void);
-void _glfwWaitEventsTimeoutX11(double timeout);
+void _glfwWaitEventsUntilX11(uint64_t deadline);
 void _glfwPostEmptyEventX11(void);
 
 void _glfwGetCursorPosX11(_GLFWwindow* window, double* xpos, double* ypos);
@@ -953,6 +1045,7 @@ void _glfwDestroyCursorX11(_GLFWcursor* cursor);
 void _glfwSetCursorX11(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringX11(const char* string);
 const char* _glfwGetClipboardStringX11(void);
+void _glfwRequestClipboardStringX11(_GLFWwindow* window);
 
 EGLenum _glfwGetEGLPlatformX11(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayX11(void);
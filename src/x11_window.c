@@ -32,6 +32,8 @@
 #include <X11/cursorfont.h>
 #include <X11/Xmd.h>
 
+#include <sys/ipc.h>
+#include <sys/shm.h>
 #include <poll.h>
 
 #include <string.h>
@@ -60,13 +62,13 @@
 // This avoids blocking other threads via the per-display Xlib lock that also
 // covers GLX functions
 //
-static GLFWbool waitForX11Event(double* timeout)
+static GLFWbool waitForX11Event(const uint64_t* deadline)
 {
     struct pollfd fd = { ConnectionNumber(_glfw.x11.display), POLLIN };
 
     while (!XPending(_glfw.x11.display))
     {
-        if (!_glfwPollPOSIX(&fd, 1, timeout))
+        if (!_glfwPollPOSIX(&fd, 1, deadline))
             return GLFW_FALSE;
     }
 
@@ -77,7 +79,7 @@ static GLFWbool waitForX11Event(double* timeout)
 // This avoids blocking other threads via the per-display Xlib lock that also
 // covers GLX functions
 //
-static GLFWbool waitForAnyEvent(double* timeout)
+static GLFWbool waitForAnyEvent(const uint64_t* deadline)
 {
     enum { XLIB_FD, PIPE_FD, INOTIFY_FD };
     struct pollfd fds[] =
@@ -94,7 +96,7 @@ static GLFWbool waitForAnyEvent(double* timeout)
 
     while (!XPending(_glfw.x11.display))
     {
-        if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), timeout))
+        if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), deadline))
             return GLFW_FALSE;
 
         for (int i = 1; i < sizeof(fds) / sizeof(fds[0]); i++)
@@ -139,14 +141,15 @@ static void drainEmptyEvents(void)
 static GLFWbool waitForVisibilityNotify(_GLFWwindow* window)
 {
     XEvent dummy;
-    double timeout = 0.1;
+    const uint64_t deadline = _glfwPlatformGetTimerValue() +
+        _glfwPlatformGetTimerFrequency() / 10;
 
     while (!XCheckTypedWindowEvent(_glfw.x11.display,
                                    window->x11.handle,
                                    VisibilityNotify,
                                    &dummy))
     {
-        if (!waitForX11Event(&timeout))
+        if (!waitForX11Event(&deadline))
             return GLFW_FALSE;
     }
 
@@ -444,6 +447,9 @@ static char* convertLatin1toUTF8(const char* source)
         size += (*sp & 0x80) ? 2 : 1;
 
     char* target = _glfw_calloc(size, 1);
+    if (!target)
+        return NULL;
+
     char* tp = target;
 
     for (sp = source;  *sp;  sp++)
@@ -1083,6 +1089,175 @@ static const char* getSelectionString(Atom selection)
     return *selectionString;
 }
 
+// Requests conversion of the clipboard to the specified target for the
+// specified window, with the result delivered as events to that window
+//
+static void convertClipboard(_GLFWwindow* window, Atom target)
+{
+    window->x11.clipboard.target = target;
+    window->x11.clipboard.incr = GLFW_FALSE;
+
+    XConvertSelection(_glfw.x11.display,
+                      _glfw.x11.CLIPBOARD,
+                      target,
+                      _glfw.x11.GLFW_SELECTION,
+                      window->x11.handle,
+                      CurrentTime);
+    XFlush(_glfw.x11.display);
+}
+
+// Appends data to the clipboard transfer of the specified window
+//
+static GLFWbool appendClipboardData(_GLFWwindow* window,
+                                    const char* data,
+                                    size_t count)
+{
+    const size_t required = window->x11.clipboard.length + count + 1;
+    if (required > window->x11.clipboard.size)
+    {
+        size_t size = window->x11.clipboard.size ? window->x11.clipboard.size : 4096;
+        while (size < required)
+            size *= 2;
+
+        char* longer = _glfw_realloc(window->x11.clipboard.data, size);
+        if (!longer)
+        {
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            return GLFW_FALSE;
+        }
+
+        window->x11.clipboard.data = longer;
+        window->x11.clipboard.size = size;
+    }
+
+    memcpy(window->x11.clipboard.data + window->x11.clipboard.length, data, count);
+    window->x11.clipboard.length += count;
+    window->x11.clipboard.data[window->x11.clipboard.length] = '\0';
+    return GLFW_TRUE;
+}
+
+// Ends the clipboard transfer of the specified window and delivers its result
+// Any error has already been reported by the caller
+//
+static void finishClipboardTransfer(_GLFWwindow* window, GLFWbool succeeded)
+{
+    char* data = window->x11.clipboard.data;
+    char* string = NULL;
+
+    if (succeeded)
+    {
+        if (window->x11.clipboard.target == XA_STRING)
+            string = convertLatin1toUTF8(data ? data : "");
+        else
+            string = data ? data : _glfw_strdup("");
+
+        if (string == data)
+            data = NULL;
+    }
+
+    // The transfer is reset first so that the callback may make a new request
+    _glfw_free(data);
+    memset(&window->x11.clipboard, 0, sizeof(window->x11.clipboard));
+
+    _glfwInputClipboardString(window, string);
+    _glfw_free(string);
+}
+
+// Handles the owner's reply to a clipboard conversion request
+//
+static void handleClipboardNotify(_GLFWwindow* window,
+                                  const XSelectionEvent* notification)
+{
+    if (notification->property != None)
+    {
+        char* data = NULL;
+        Atom actualType;
+        int actualFormat;
+        unsigned long itemCount, bytesAfter;
+
+        XGetWindowProperty(_glfw.x11.display,
+                           window->x11.handle,
+                           notification->property,
+                           0,
+                           LONG_MAX,
+                           True,
+                           AnyPropertyType,
+                           &actualType,
+                           &actualFormat,
+                           &itemCount,
+                           &bytesAfter,
+                           (unsigned char**) &data);
+
+        if (actualType == _glfw.x11.INCR)
+        {
+            // Deleting the property above asked the owner to start sending
+            // chunks, which are read as the property is changed
+            window->x11.clipboard.incr = GLFW_TRUE;
+            XFree(data);
+            return;
+        }
+
+        if (actualType == window->x11.clipboard.target)
+        {
+            const GLFWbool succeeded = appendClipboardData(window, data, itemCount);
+            XFree(data);
+            finishClipboardTransfer(window, succeeded);
+            return;
+        }
+
+        if (data)
+            XFree(data);
+    }
+
+    if (window->x11.clipboard.target == _glfw.x11.UTF8_STRING)
+        convertClipboard(window, XA_STRING);
+    else
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "X11: Failed to convert selection to string");
+        finishClipboardTransfer(window, GLFW_FALSE);
+    }
+}
+
+// Reads the next chunk of an incremental clipboard transfer
+//
+static void readClipboardChunk(_GLFWwindow* window)
+{
+    char* data = NULL;
+    Atom actualType;
+    int actualFormat;
+    unsigned long itemCount, bytesAfter;
+
+    XGetWindowProperty(_glfw.x11.display,
+                       window->x11.handle,
+                       _glfw.x11.GLFW_SELECTION,
+                       0,
+                       LONG_MAX,
+                       True,
+                       AnyPropertyType,
+                       &actualType,
+                       &actualFormat,
+                       &itemCount,
+                       &bytesAfter,
+                       (unsigned char**) &data);
+
+    if (!itemCount)
+    {
+        // A zero-length chunk marks the end of the transfer
+        if (data)
+            XFree(data);
+
+        finishClipboardTransfer(window, GLFW_TRUE);
+        return;
+    }
+
+    const GLFWbool succeeded = appendClipboardData(window, data, itemCount);
+    XFree(data);
+
+    if (!succeeded)
+        finishClipboardTransfer(window, GLFW_FALSE);
+}
+
 // Make the specified window and its video mode active on its monitor
 //
 static void acquireMonitor(_GLFWwindow* window)
@@ -1145,6 +1320,209 @@ static void releaseMonitor(_GLFWwindow* window)
     }
 }
 
+// Returns whether the event is a completion of a pixel buffer upload
+//
+static Bool isShmCompletionEvent(Display* display, XEvent* event, XPointer pointer)
+{
+    _GLFWwindow* window = (_GLFWwindow*) pointer;
+    return event->type == _glfw.x11.xshm.eventBase + ShmCompletion &&
+           event->xany.window == window->x11.handle;
+}
+
+// Marks the pixel buffer image uploaded by the completed request as unused
+//
+static void handleShmCompletion(_GLFWwindow* window, const XShmCompletionEvent* event)
+{
+    for (int i = 0;  i < 2;  i++)
+    {
+        if (window->x11.pixels.images[i] &&
+            window->x11.pixels.segments[i].shmseg == event->shmseg)
+        {
+            window->x11.pixels.busy[i] = GLFW_FALSE;
+        }
+    }
+}
+
+static void destroyPixelBuffers(_GLFWwindow* window)
+{
+    if (window->x11.pixels.shm)
+    {
+        for (int i = 0;  i < 2;  i++)
+        {
+            if (window->x11.pixels.images[i])
+                XShmDetach(_glfw.x11.display, &window->x11.pixels.segments[i]);
+        }
+
+        // The server must have detached the segments before they are unmapped
+        XSync(_glfw.x11.display, False);
+    }
+
+    for (int i = 0;  i < 2;  i++)
+    {
+        XImage* image = window->x11.pixels.images[i];
+        if (!image)
+            continue;
+
+        if (window->x11.pixels.shm)
+            shmdt(window->x11.pixels.segments[i].shmaddr);
+        else
+            _glfw_free(image->data);
+
+        // The image data was not allocated by Xlib so it must not free it
+        image->data = NULL;
+        XDestroyImage(image);
+
+        window->x11.pixels.images[i] = NULL;
+        window->x11.pixels.busy[i] = GLFW_FALSE;
+    }
+
+    window->x11.pixels.width = 0;
+    window->x11.pixels.height = 0;
+}
+
+// Creates an image backed by a shared memory segment attached by the server
+//
+static XImage* createShmImage(Visual* visual, int depth, int width, int height,
+                              XShmSegmentInfo* segment)
+{
+    XImage* image = XShmCreateImage(_glfw.x11.display, visual, depth, ZPixmap,
+                                    NULL, segment, width, height);
+    if (!image)
+        return NULL;
+
+    segment->shmid = shmget(IPC_PRIVATE,
+                            (size_t) image->bytes_per_line * image->height,
+                            IPC_CREAT | 0600);
+    if (segment->shmid == -1)
+    {
+        XDestroyImage(image);
+        return NULL;
+    }
+
+    segment->shmaddr = shmat(segment->shmid, NULL, 0);
+    if (segment->shmaddr == (char*) -1)
+    {
+        shmctl(segment->shmid, IPC_RMID, NULL);
+        XDestroyImage(image);
+        return NULL;
+    }
+
+    segment->readOnly = False;
+    image->data = segment->shmaddr;
+
+    // NOTE: Attaching fails for clients on another host even when the server
+    //       supports the extension
+    _glfwGrabErrorHandlerX11();
+    XShmAttach(_glfw.x11.display, segment);
+    _glfwReleaseErrorHandlerX11();
+
+    // The segment is destroyed once both the client and server have detached
+    shmctl(segment->shmid, IPC_RMID, NULL);
+
+    if (_glfw.x11.errorCode != Success)
+    {
+        shmdt(segment->shmaddr);
+        image->data = NULL;
+        XDestroyImage(image);
+        return NULL;
+    }
+
+    return image;
+}
+
+// Clips a damage rectangle to the specified image and returns whether anything
+// remains of it
+//
+static GLFWbool clipPixelBufferRect(const XImage* image, const int* rect,
+                                    int* x, int* y, int* w, int* h)
+{
+    *x = _glfw_max(rect[0], 0);
+    *y = _glfw_max(rect[1], 0);
+    *w = _glfw_min(rect[0] + rect[2], image->width) - *x;
+    *h = _glfw_min(rect[1] + rect[3], image->height) - *y;
+    return *w > 0 && *h > 0;
+}
+
+// Creates the pixel buffer images of the window, using MIT-SHM if possible
+//
+static GLFWbool createPixelBuffers(_GLFWwindow* window, int width, int height)
+{
+    const int one = 1;
+    const int hostByteOrder = *((const char*) &one) ? LSBFirst : MSBFirst;
+    XWindowAttributes attribs;
+
+    XGetWindowAttributes(_glfw.x11.display, window->x11.handle, &attribs);
+
+    Visual* visual = attribs.visual;
+    if (visual->class != TrueColor ||
+        visual->red_mask != 0x00ff0000 ||
+        visual->green_mask != 0x0000ff00 ||
+        visual->blue_mask != 0x000000ff)
+    {
+        _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                        "X11: The window visual is not compatible with pixel buffers");
+        return GLFW_FALSE;
+    }
+
+    // NOTE: Shared memory images are not converted, so they can only be used
+    //       if the server has the same byte order as the client
+    if (_glfw.x11.xshm.available && ImageByteOrder(_glfw.x11.display) == hostByteOrder)
+    {
+        window->x11.pixels.shm = GLFW_TRUE;
+
+        for (int i = 0;  i < 2;  i++)
+        {
+            window->x11.pixels.images[i] =
+                createShmImage(visual, attribs.depth, width, height,
+                               &window->x11.pixels.segments[i]);
+            if (!window->x11.pixels.images[i])
+            {
+                destroyPixelBuffers(window);
+                window->x11.pixels.shm = GLFW_FALSE;
+                break;
+            }
+        }
+    }
+    else
+        window->x11.pixels.shm = GLFW_FALSE;
+
+    if (!window->x11.pixels.shm)
+    {
+        XImage* image = XCreateImage(_glfw.x11.display, visual, attribs.depth,
+                                     ZPixmap, 0, NULL, width, height, 32, 0);
+        if (!image)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "X11: Failed to create pixel buffer image");
+            return GLFW_FALSE;
+        }
+
+        image->data = _glfw_calloc(image->height, image->bytes_per_line);
+        if (!image->data)
+        {
+            XDestroyImage(image);
+            return GLFW_FALSE;
+        }
+
+        // Xlib converts the image to the byte order of the server when sent
+        image->byte_order = hostByteOrder;
+        window->x11.pixels.images[0] = image;
+    }
+
+    if (window->x11.pixels.images[0]->bits_per_pixel != 32)
+    {
+        destroyPixelBuffers(window);
+        _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                        "X11: The window visual is not compatible with pixel buffers");
+        return GLFW_FALSE;
+    }
+
+    window->x11.pixels.width = width;
+    window->x11.pixels.height = height;
+    window->x11.pixels.back = 0;
+    return GLFW_TRUE;
+}
+
 // Process the specified X event
 //
 static void processEvent(XEvent *event)
@@ -1236,6 +1614,13 @@ static void processEvent(XEvent *event)
         return;
     }
 
+    if (_glfw.x11.xshm.available &&
+        event->type == _glfw.x11.xshm.eventBase + ShmCompletion)
+    {
+        handleShmCompletion(window, (XShmCompletionEvent*) event);
+        return;
+    }
+
     switch (event->type)
     {
         case ReparentNotify:
@@ -1736,6 +2121,12 @@ static void processEvent(XEvent *event)
                     XFlush(_glfw.x11.display);
                 }
             }
+            else if (event->xselection.selection == _glfw.x11.CLIPBOARD &&
+                     event->xselection.target == window->x11.clipboard.target &&
+                     window->x11.clipboard.target != None)
+            {
+                handleClipboardNotify(window, &event->xselection);
+            }
 
             return;
         }
@@ -1828,6 +2219,11 @@ static void processEvent(XEvent *event)
                     _glfwInputWindowMaximize(window, maximized);
                 }
             }
+            else if (event->xproperty.atom == _glfw.x11.GLFW_SELECTION &&
+                     window->x11.clipboard.incr)
+            {
+                readClipboardChunk(window);
+            }
 
             return;
         }
@@ -1968,6 +2364,13 @@ GLFWbool _glfwCreateWindowX11(_GLFWwindow* window,
     Visual* visual = NULL;
     int depth;
 
+    if (wndconfig->parent)
+    {
+        _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                        "X11: Window layers are not yet implemented");
+        return GLFW_FALSE;
+    }
+
     if (ctxconfig->client != GLFW_NO_API)
     {
         if (ctxconfig->source == GLFW_NATIVE_CONTEXT_API)
@@ -2065,6 +2468,16 @@ void _glfwDestroyWindowX11(_GLFWwindow* window)
     if (window->context.destroy)
         window->context.destroy(window);
 
+    destroyPixelBuffers(window);
+
+    if (window->x11.pixels.gc)
+    {
+        XFreeGC(_glfw.x11.display, window->x11.pixels.gc);
+        window->x11.pixels.gc = NULL;
+    }
+
+    _glfw_free(window->x11.clipboard.data);
+
     if (window->x11.handle)
     {
         XDeleteContext(_glfw.x11.display, window->x11.handle, _glfw.x11.context);
@@ -2082,6 +2495,35 @@ void _glfwDestroyWindowX11(_GLFWwindow* window)
     XFlush(_glfw.x11.display);
 }
 
+GLFWbool _glfwCreateOffscreenContextX11(_GLFWwindow* window,
+                                        const _GLFWctxconfig* ctxconfig,
+                                        const _GLFWfbconfig* fbconfig)
+{
+    if (ctxconfig->source == GLFW_NATIVE_CONTEXT_API)
+    {
+        if (!_glfwInitGLX())
+            return GLFW_FALSE;
+        if (!_glfwCreateContextGLX(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
+    }
+    else if (ctxconfig->source == GLFW_EGL_CONTEXT_API)
+    {
+        if (!_glfwInitEGL())
+            return GLFW_FALSE;
+        if (!_glfwCreateContextEGL(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
+    }
+    else if (ctxconfig->source == GLFW_OSMESA_CONTEXT_API)
+    {
+        if (!_glfwInitOSMesa())
+            return GLFW_FALSE;
+        if (!_glfwCreateContextOSMesa(window, ctxconfig, fbconfig))
+            return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
 void _glfwSetWindowTitleX11(_GLFWwindow* window, const char* title)
 {
     if (_glfw.x11.xlib.utf8)
@@ -2266,7 +2708,8 @@ void _glfwGetWindowFrameSizeX11(_GLFWwindow* window,
         _glfw.x11.NET_REQUEST_FRAME_EXTENTS)
     {
         XEvent event;
-        double timeout = 0.5;
+        const uint64_t deadline = _glfwPlatformGetTimerValue() +
+            _glfwPlatformGetTimerFrequency() / 2;
 
         // Ensure _NET_FRAME_EXTENTS is set, allowing glfwGetWindowFrameSize to
         // function before the window is mapped
@@ -2283,7 +2726,7 @@ void _glfwGetWindowFrameSizeX11(_GLFWwindow* window,
                               isFrameExtentsEvent,
                               (XPointer) window))
         {
-            if (!waitForX11Event(&timeout))
+            if (!waitForX11Event(&deadline))
             {
                 _glfwInputError(GLFW_PLATFORM_ERROR,
                                 "X11: The window manager has a broken _NET_REQUEST_FRAME_EXTENTS implementation; please report this issue");
@@ -2755,6 +3198,101 @@ void _glfwSetWindowMousePassthroughX11(_GLFWwindow* window, GLFWbool enabled)
     }
 }
 
+unsigned char* _glfwGetWindowPixelBufferX11(_GLFWwindow* window,
+                                            int* width, int* height,
+                                            int* stride)
+{
+    if (!window->x11.pixels.gc)
+        window->x11.pixels.gc = XCreateGC(_glfw.x11.display, window->x11.handle, 0, NULL);
+
+    if (window->x11.pixels.width != window->x11.width ||
+        window->x11.pixels.height != window->x11.height)
+    {
+        destroyPixelBuffers(window);
+
+        if (!createPixelBuffers(window, window->x11.width, window->x11.height))
+            return NULL;
+    }
+
+    const int back = window->x11.pixels.back;
+
+    // The server completes uploads in order, so this wait is short
+    while (window->x11.pixels.busy[back])
+    {
+        XEvent event;
+        XIfEvent(_glfw.x11.display, &event, isShmCompletionEvent, (XPointer) window);
+        handleShmCompletion(window, (XShmCompletionEvent*) &event);
+    }
+
+    XImage* image = window->x11.pixels.images[back];
+
+    *width = image->width;
+    *height = image->height;
+    *stride = image->bytes_per_line;
+    return (unsigned char*) image->data;
+}
+
+void _glfwPresentPixelBufferX11(_GLFWwindow* window, const int* rects, int count)
+{
+    const int back = window->x11.pixels.back;
+    XImage* image = window->x11.pixels.images[back];
+    if (!image)
+        return;
+
+    const int full[4] = { 0, 0, image->width, image->height };
+    if (count == 0)
+    {
+        rects = full;
+        count = 1;
+    }
+
+    // Only the last upload requests a completion event, which then covers
+    // every upload before it as requests are processed in order
+    int last = -1;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        int x, y, w, h;
+        if (clipPixelBufferRect(image, rects + i * 4, &x, &y, &w, &h))
+            last = i;
+    }
+
+    for (int i = 0;  i <= last;  i++)
+    {
+        int x, y, w, h;
+        if (!clipPixelBufferRect(image, rects + i * 4, &x, &y, &w, &h))
+            continue;
+
+        if (window->x11.pixels.shm)
+        {
+            XShmPutImage(_glfw.x11.display, window->x11.handle,
+                         window->x11.pixels.gc, image,
+                         x, y, x, y, w, h, i == last);
+        }
+        else
+        {
+            XPutImage(_glfw.x11.display, window->x11.handle,
+                      window->x11.pixels.gc, image,
+                      x, y, x, y, w, h);
+        }
+    }
+
+    if (window->x11.pixels.shm && last != -1)
+    {
+        window->x11.pixels.busy[back] = GLFW_TRUE;
+        window->x11.pixels.back = back ^ 1;
+    }
+
+    XFlush(_glfw.x11.display);
+}
+
+GLFWbool _glfwSetWindowRenderScaleX11(_GLFWwindow* window, float scale)
+{
+    _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                    "X11: Window render scaling is not supported");
+    return GLFW_FALSE;
+}
+
 float _glfwGetWindowOpacityX11(_GLFWwindow* window)
 {
     float opacity = 1.f;
@@ -2846,9 +3384,9 @@ void _glfwWaitEventsX11(void)
     _glfwPollEventsX11();
 }
 
-void _glfwWaitEventsTimeoutX11(double timeout)
+void _glfwWaitEventsUntilX11(uint64_t deadline)
 {
-    waitForAnyEvent(&timeout);
+    waitForAnyEvent(&deadline);
     _glfwPollEventsX11();
 }
 
@@ -3110,6 +3648,23 @@ const char* _glfwGetClipboardStringX11(void)
     return getSelectionString(_glfw.x11.CLIPBOARD);
 }
 
+void _glfwRequestClipboardStringX11(_GLFWwindow* window)
+{
+    // NOTE: The owner may never reply to a conversion, so a transfer already
+    //       in progress is abandoned and replaced by this request
+    _glfw_free(window->x11.clipboard.data);
+    memset(&window->x11.clipboard, 0, sizeof(window->x11.clipboard));
+
+    if (XGetSelectionOwner(_glfw.x11.display, _glfw.x11.CLIPBOARD) ==
+        _glfw.x11.helperWindowHandle)
+    {
+        _glfwInputClipboardString(window, _glfw.x11.clipboardString);
+        return;
+    }
+
+    convertClipboard(window, _glfw.x11.UTF8_STRING);
+}
+
 EGLenum _glfwGetEGLPlatformX11(EGLint** attribs)
 {
     if (_glfw.egl.ANGLE_platform_angle)
@@ -25,6 +25,9 @@
 //
 // This program is used to test the clipboard functionality.
 //
+// Press the modifier and C to set the clipboard, the modifier and V to read it
+// and the modifier, Shift and V to request it asynchronously
+//
 //========================================================================
 
 #define GLAD_GL_IMPLEMENTATION
@@ -53,6 +56,14 @@ static void error_callback(int error, const char* description)
     fprintf(stderr, "Error: %s\n", description);
 }
 
+static void clipboard_callback(GLFWwindow* window, const char* string)
+{
+    if (string)
+        printf("Clipboard request returned \"%s\"\n", string);
+    else
+        printf("Clipboard request returned no string\n");
+}
+
 static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
     if (action != GLFW_PRESS)
@@ -75,6 +86,11 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
                 else
                     printf("Clipboard does not contain a string\n");
             }
+            else if (mods == (MODIFIER | GLFW_MOD_SHIFT))
+            {
+                printf("Requesting clipboard contents\n");
+                glfwRequestClipboardString(window, clipboard_callback);
+            }
             break;
 
         case GLFW_KEY_C:
@@ -0,0 +1,232 @@
+//========================================================================
+// Context pool test
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test creates an offscreen context and a pool of contexts sharing
+// objects with it, then has more worker threads than there are pooled
+// contexts repeatedly acquire a context, verify that it sees a texture
+// created in the offscreen context and release it again
+//
+//========================================================================
+
+#include "tinycthread.h"
+
+#define GLAD_GL_IMPLEMENTATION
+#include <glad/gl.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+typedef struct
+{
+    thrd_t id;
+    unsigned long acquired;
+    unsigned long busy;
+    int failed;
+} Worker;
+
+static GLFWcontextpool* pool;
+static GLuint texture;
+static unsigned long iterations = 1000;
+
+static void usage(void)
+{
+    printf("Usage: contextpool [-e] [-n] [-c COUNT] [-t THREADS] [-i ITERATIONS]\n");
+    printf("       contextpool -h\n");
+    printf("Options:\n");
+    printf("  -c  Number of contexts in the pool\n");
+    printf("  -e  Create contexts with EGL\n");
+    printf("  -i  Number of contexts each thread acquires\n");
+    printf("  -n  Use the Null platform\n");
+    printf("  -t  Number of worker threads\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static int worker_main(void* data)
+{
+    Worker* worker = data;
+
+    while (worker->acquired < iterations && !worker->failed)
+    {
+        GLFWwindow* context = glfwAcquirePooledContext(pool);
+        if (!context)
+        {
+            worker->busy++;
+            thrd_yield();
+            continue;
+        }
+
+        if (glfwGetCurrentContext() != context || !glIsTexture(texture))
+            worker->failed = GLFW_TRUE;
+
+        glFinish();
+        glfwReleasePooledContext(context);
+
+        if (glfwGetCurrentContext())
+            worker->failed = GLFW_TRUE;
+
+        worker->acquired++;
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, result, egl = GLFW_FALSE, failed = GLFW_FALSE;
+    int context_count = 2, thread_count = 4;
+    GLFWwindow* offscreen;
+    Worker* workers;
+
+    while ((ch = getopt(argc, argv, "c:ehi:nt:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'c':
+                context_count = atoi(optarg);
+                break;
+            case 'e':
+                egl = GLFW_TRUE;
+                break;
+            case 'i':
+                iterations = strtoul(optarg, NULL, 10);
+                break;
+            case 'n':
+                glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+                break;
+            case 't':
+                thread_count = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (context_count <= 0 || thread_count <= 0)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    if (egl)
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+
+    offscreen = glfwCreateOffscreenContext(64, 64, NULL);
+    if (!offscreen)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwMakeContextCurrent(offscreen);
+    gladLoadGL(glfwGetProcAddress);
+
+    printf("Offscreen context uses %s\n", (const char*) glGetString(GL_RENDERER));
+
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glFinish();
+
+    pool = glfwCreateContextPool(context_count, offscreen);
+    if (!pool)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    // A pooled context must be released by the thread that acquired it and
+    // acquiring one replaces the context that was current
+    {
+        GLFWwindow* context = glfwAcquirePooledContext(pool);
+        if (!context || glfwGetCurrentContext() != context)
+            failed = GLFW_TRUE;
+
+        glfwReleasePooledContext(context);
+        glfwMakeContextCurrent(NULL);
+    }
+
+    workers = calloc(thread_count, sizeof(Worker));
+
+    printf("Acquiring %lu contexts on each of %i threads from a pool of %i\n",
+           iterations, thread_count, context_count);
+
+    const double start = glfwGetTime();
+
+    for (int i = 0;  i < thread_count;  i++)
+    {
+        if (thrd_create(&workers[i].id, worker_main, workers + i) != thrd_success)
+        {
+            fprintf(stderr, "Failed to create worker thread\n");
+
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    for (int i = 0;  i < thread_count;  i++)
+    {
+        thrd_join(workers[i].id, &result);
+
+        printf("Thread %i acquired %lu contexts and found the pool empty %lu times\n",
+               i, workers[i].acquired, workers[i].busy);
+
+        if (workers[i].failed)
+            failed = GLFW_TRUE;
+    }
+
+    printf("Finished in %.3f seconds\n", glfwGetTime() - start);
+
+    free(workers);
+
+    glfwDestroyContextPool(pool);
+    glfwDestroyWindow(offscreen);
+    glfwTerminate();
+
+    if (failed)
+    {
+        printf("A pooled context was not current or did not share objects\n");
+        exit(EXIT_FAILURE);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
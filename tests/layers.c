@@ -0,0 +1,181 @@
+//========================================================================
+// Window layer test
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test shows a transparent layer with a fast moving bar over a parent
+// window whose color only changes once per second, allowing for visual
+// verification that window layers are presented independently of their
+// parent and stay in place relative to its content area
+//
+// Use the arrow keys to move the layer and space to hide or show it
+//
+//========================================================================
+
+#define GLAD_GL_IMPLEMENTATION
+#include <glad/gl.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LAYER_WIDTH 400
+#define LAYER_HEIGHT 100
+
+static GLFWwindow* layer;
+static int second = -1;
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+    // Redraw the parent window on the next frame
+    second = -1;
+}
+
+static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    int xpos, ypos;
+
+    if (action == GLFW_RELEASE)
+        return;
+
+    glfwGetWindowPos(layer, &xpos, &ypos);
+
+    switch (key)
+    {
+        case GLFW_KEY_ESCAPE:
+            glfwSetWindowShouldClose(window, GLFW_TRUE);
+            break;
+        case GLFW_KEY_SPACE:
+            if (action != GLFW_PRESS)
+                break;
+            if (glfwGetWindowAttrib(layer, GLFW_VISIBLE))
+                glfwHideWindow(layer);
+            else
+                glfwShowWindow(layer);
+            break;
+        case GLFW_KEY_LEFT:
+            glfwSetWindowPos(layer, xpos - 10, ypos);
+            break;
+        case GLFW_KEY_RIGHT:
+            glfwSetWindowPos(layer, xpos + 10, ypos);
+            break;
+        case GLFW_KEY_UP:
+            glfwSetWindowPos(layer, xpos, ypos - 10);
+            break;
+        case GLFW_KEY_DOWN:
+            glfwSetWindowPos(layer, xpos, ypos + 10);
+            break;
+    }
+}
+
+int main(void)
+{
+    GLFWwindow* window;
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    window = glfwCreateWindow(640, 480, "Window Layer Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, GLFW_TRUE);
+
+    layer = glfwCreateWindowLayer(window, LAYER_WIDTH, LAYER_HEIGHT, window);
+    if (!layer)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetWindowPos(layer, 120, 190);
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetKeyCallback(window, key_callback);
+
+    glfwMakeContextCurrent(window);
+    gladLoadGL(glfwGetProcAddress);
+    glfwSwapInterval(0);
+
+    glfwMakeContextCurrent(layer);
+    glfwSwapInterval(1);
+    glEnable(GL_SCISSOR_TEST);
+
+    while (!glfwWindowShouldClose(window))
+    {
+        int width, height;
+        const double time = glfwGetTime();
+
+        // The parent window is only redrawn when its color changes
+        if ((int) time != second)
+        {
+            second = (int) time;
+
+            glfwMakeContextCurrent(window);
+            glfwGetFramebufferSize(window, &width, &height);
+            glViewport(0, 0, width, height);
+
+            if (second % 2)
+                glClearColor(0.2f, 0.2f, 0.5f, 1.f);
+            else
+                glClearColor(0.5f, 0.2f, 0.2f, 1.f);
+
+            glClear(GL_COLOR_BUFFER_BIT);
+            glfwSwapBuffers(window);
+        }
+
+        glfwMakeContextCurrent(layer);
+        glfwGetFramebufferSize(layer, &width, &height);
+
+        glScissor(0, 0, width, height);
+        glClearColor(0.f, 0.f, 0.f, 0.f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        const int bar_width = width / 10;
+        if (bar_width > 0)
+        {
+            const int bar_x = (int) (time * width / 2.0) % (width - bar_width);
+
+            glScissor(bar_x, 0, bar_width, height);
+            glClearColor(1.f, 1.f, 1.f, 1.f);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
+
+        glfwSwapBuffers(layer);
+        glfwPollEvents();
+    }
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
+
@@ -0,0 +1,270 @@
+//========================================================================
+// Null platform threading test
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test has several threads repeatedly create and destroy windows on the
+// Null platform.  The main thread focuses each new window and then takes focus
+// back to its own window while the window is being destroyed, to check that
+// window creation from any thread and the focus state shared between threads
+// hold up under contention
+//
+//========================================================================
+
+#include "tinycthread.h"
+
+#define GLAD_GL_IMPLEMENTATION
+#include <glad/gl.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+typedef struct
+{
+    thrd_t id;
+    GLFWwindow* pending;
+    unsigned long created;
+    int failed;
+} Worker;
+
+static mtx_t lock;
+static int finished;
+static unsigned long iterations = 1000;
+static int client_api = GLFW_NO_API;
+static unsigned long focus_gained, focus_lost;
+
+static void usage(void)
+{
+    printf("Usage: nullthreads [-c] [-t THREADS] [-i ITERATIONS]\n");
+    printf("       nullthreads -h\n");
+    printf("Options:\n");
+    printf("  -c  Create an EGL context for each window\n");
+    printf("  -i  Number of windows each thread creates\n");
+    printf("  -t  Number of worker threads\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void focus_callback(GLFWwindow* window, int gained)
+{
+    if (gained)
+        focus_gained++;
+    else
+        focus_lost++;
+}
+
+static int worker_main(void* data)
+{
+    Worker* worker = data;
+
+    while (worker->created < iterations)
+    {
+        GLFWwindow* window = glfwCreateWindow(64, 64, "Worker", NULL, NULL);
+        if (!window)
+        {
+            worker->failed = GLFW_TRUE;
+            break;
+        }
+
+        if (client_api != GLFW_NO_API)
+        {
+            glfwMakeContextCurrent(window);
+            glClear(GL_COLOR_BUFFER_BIT);
+            glfwSwapBuffers(window);
+            glfwMakeContextCurrent(NULL);
+        }
+
+        mtx_lock(&lock);
+        worker->pending = window;
+        mtx_unlock(&lock);
+
+        // Poll rather than wait on a condition, so that the window is destroyed
+        // as soon as possible after the main thread has focused it
+        for (;;)
+        {
+            mtx_lock(&lock);
+            const int pending = worker->pending != NULL;
+            mtx_unlock(&lock);
+
+            if (!pending)
+                break;
+
+            thrd_yield();
+        }
+
+        glfwDestroyWindow(window);
+
+        worker->created++;
+    }
+
+    mtx_lock(&lock);
+    finished++;
+    mtx_unlock(&lock);
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, result, failed = GLFW_FALSE;
+    int thread_count = 4;
+    GLFWwindow* window;
+    Worker* workers;
+
+    while ((ch = getopt(argc, argv, "chi:t:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'c':
+                client_api = GLFW_OPENGL_API;
+                break;
+            case 'i':
+                iterations = strtoul(optarg, NULL, 10);
+                break;
+            case 't':
+                thread_count = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (thread_count <= 0)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_CLIENT_API, client_api);
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+
+    window = glfwCreateWindow(64, 64, "Main", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    if (client_api != GLFW_NO_API)
+    {
+        glfwMakeContextCurrent(window);
+        gladLoadGL(glfwGetProcAddress);
+        glfwMakeContextCurrent(NULL);
+    }
+
+    glfwSetWindowFocusCallback(window, focus_callback);
+
+    mtx_init(&lock, mtx_plain);
+    workers = calloc(thread_count, sizeof(Worker));
+
+    printf("Creating %lu windows on each of %i threads\n", iterations, thread_count);
+
+    const double start = glfwGetTime();
+
+    for (int i = 0;  i < thread_count;  i++)
+    {
+        if (thrd_create(&workers[i].id, worker_main, workers + i) != thrd_success)
+        {
+            fprintf(stderr, "Failed to create worker thread\n");
+
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    for (;;)
+    {
+        mtx_lock(&lock);
+
+        const int done = finished == thread_count;
+
+        for (int i = 0;  i < thread_count;  i++)
+        {
+            if (workers[i].pending)
+            {
+                glfwFocusWindow(workers[i].pending);
+                workers[i].pending = NULL;
+            }
+        }
+
+        mtx_unlock(&lock);
+
+        if (done)
+            break;
+
+        // The worker windows may now be destroyed while losing focus
+        glfwFocusWindow(window);
+        glfwPollEvents();
+        thrd_yield();
+    }
+
+    for (int i = 0;  i < thread_count;  i++)
+    {
+        thrd_join(workers[i].id, &result);
+
+        printf("Thread %i created %lu windows\n", i, workers[i].created);
+
+        if (workers[i].failed)
+            failed = GLFW_TRUE;
+    }
+
+    glfwFocusWindow(window);
+    glfwPollEvents();
+
+    printf("Finished in %.3f seconds\n", glfwGetTime() - start);
+    printf("Main window gained focus %lu times and lost it %lu times\n",
+           focus_gained, focus_lost);
+
+    if (!glfwGetWindowAttrib(window, GLFW_FOCUSED))
+    {
+        printf("Main window did not regain focus\n");
+        failed = GLFW_TRUE;
+    }
+
+    free(workers);
+    mtx_destroy(&lock);
+    glfwTerminate();
+
+    if (failed)
+        exit(EXIT_FAILURE);
+
+    exit(EXIT_SUCCESS);
+}
+
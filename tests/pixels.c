@@ -0,0 +1,156 @@
+//========================================================================
+// Pixel buffer test
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test draws a horizontally moving bar into the pixel buffer of a window
+// without a context, presenting only the changed parts of each frame unless
+// full presents are requested, allowing for visual verification of pixel
+// buffers and their damage rectangles
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "getopt.h"
+
+#define BAR_WIDTH 40
+
+static int previous_x = -1;
+
+static void usage(void)
+{
+    printf("Usage: pixels [-f]\n");
+    printf("       pixels -h\n");
+    printf("Options:\n");
+    printf("  -f  Present the whole buffer every frame\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+    printf("Framebuffer resized to %ix%i\n", width, height);
+    previous_x = -1;
+}
+
+static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GLFW_TRUE);
+}
+
+static void draw_frame(GLFWwindow* window, int full)
+{
+    int width, height, stride;
+    unsigned char* pixels = glfwGetWindowPixelBuffer(window, &width, &height, &stride);
+    if (!pixels)
+        return;
+
+    const int range = width > BAR_WIDTH ? width - BAR_WIDTH : 1;
+    const int x = (int) (glfwGetTime() * 200.0) % range;
+
+    for (int y = 0;  y < height;  y++)
+    {
+        uint32_t* row = (uint32_t*) (pixels + y * stride);
+        for (int i = 0;  i < width;  i++)
+        {
+            if (i >= x && i < x + BAR_WIDTH)
+                row[i] = 0xffffffff;
+            else
+                row[i] = 0xff000000 | (i & 0xff) << 8 | (y & 0xff);
+        }
+    }
+
+    if (full || previous_x == -1)
+        glfwPresentPixelBuffer(window, NULL, 0);
+    else
+    {
+        const int rects[] =
+        {
+            previous_x, 0, BAR_WIDTH, height,
+            x, 0, BAR_WIDTH, height
+        };
+
+        glfwPresentPixelBuffer(window, rects, 2);
+    }
+
+    previous_x = x;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, full = GLFW_FALSE;
+    GLFWwindow* window;
+
+    while ((ch = getopt(argc, argv, "fh")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'f':
+                full = GLFW_TRUE;
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+
+    window = glfwCreateWindow(640, 480, "Pixel Buffer Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetKeyCallback(window, key_callback);
+
+    while (!glfwWindowShouldClose(window))
+    {
+        draw_frame(window, full);
+        glfwWaitEventsTimeout(1.0 / 60.0);
+    }
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
+
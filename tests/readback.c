@@ -0,0 +1,173 @@
+//========================================================================
+// Framebuffer readback test
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test clears each frame to a color encoding its frame number, reads
+// the framebuffer back with glfwReadFramebufferAsync and checks that every
+// frame is returned, in order and with the expected latency, and that the
+// pixel pack state of the context is left as it was
+//
+//========================================================================
+
+#define GLAD_GL_IMPLEMENTATION
+#include <glad/gl.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static void usage(void)
+{
+    printf("Usage: readback [-e] [-n] [-f FRAMES]\n");
+    printf("       readback -h\n");
+    printf("Options:\n");
+    printf("  -e  Create the context with EGL\n");
+    printf("  -f  Number of frames to render\n");
+    printf("  -n  Use the Null platform\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+int main(int argc, char** argv)
+{
+    int ch, egl = GLFW_FALSE;
+    int frame_count = 300, latency = -1, errors = 0;
+    unsigned int frame, expected = 0;
+    GLint alignment, row_length;
+    GLFWwindow* window;
+
+    while ((ch = getopt(argc, argv, "ef:hn")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'e':
+                egl = GLFW_TRUE;
+                break;
+            case 'f':
+                frame_count = atoi(optarg);
+                break;
+            case 'n':
+                glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (frame_count <= 0 || frame_count > 0xffff)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    if (egl)
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+
+    window = glfwCreateWindow(320, 240, "Framebuffer Readback Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwMakeContextCurrent(window);
+    gladLoadGL(glfwGetProcAddress);
+    glfwSwapInterval(0);
+
+    printf("Context uses %s\n", (const char*) glGetString(GL_RENDERER));
+
+    // Pack state that is not tightly packed, which the readback must restore
+    glPixelStorei(GL_PACK_ALIGNMENT, 8);
+    glPixelStorei(GL_PACK_ROW_LENGTH, 1000);
+
+    for (frame = 0;  frame < (unsigned int) frame_count;  frame++)
+    {
+        int width, height;
+
+        if (glfwWindowShouldClose(window))
+            break;
+
+        glClearColor((frame & 0xff) / 255.f, (frame >> 8) / 255.f, 0.f, 1.f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        const unsigned char* pixels = glfwReadFramebufferAsync(window, &width, &height);
+        if (pixels)
+        {
+            const unsigned int captured = pixels[0] | (pixels[1] << 8);
+
+            if (latency == -1)
+            {
+                latency = (int) (frame - captured);
+                printf("Frames are returned %i frames after rendering\n", latency);
+            }
+
+            if (captured != expected || frame - captured != (unsigned int) latency)
+            {
+                printf("Frame %u returned frame %u instead of frame %u\n",
+                       frame, captured, expected);
+                errors++;
+            }
+
+            expected = captured + 1;
+        }
+
+        glGetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+        glGetIntegerv(GL_PACK_ROW_LENGTH, &row_length);
+
+        if (alignment != 8 || row_length != 1000)
+        {
+            printf("Frame %u left pack alignment %i and row length %i\n",
+                   frame, alignment, row_length);
+            errors++;
+        }
+
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+    }
+
+    printf("Captured %u of %u frames with %i errors\n", expected, frame, errors);
+
+    glfwTerminate();
+
+    if (errors || !expected)
+        exit(EXIT_FAILURE);
+
+    exit(EXIT_SUCCESS);
+}
+
@@ -0,0 +1,153 @@
+//========================================================================
+// Timer benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test measures the per-call cost of the timer functions for each
+// timer source, using the Null platform so that no window system is needed
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static volatile double double_sink;
+static volatile uint64_t integer_sink;
+
+static void usage(void)
+{
+    printf("Usage: timer [-n COUNT]\n");
+    printf("       timer -h\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static double measure_get_time(unsigned long count)
+{
+    const uint64_t start = glfwGetTimerValue();
+
+    for (unsigned long i = 0;  i < count;  i++)
+        double_sink = glfwGetTime();
+
+    return (double) (glfwGetTimerValue() - start) / glfwGetTimerFrequency();
+}
+
+static double measure_get_time_ns(unsigned long count)
+{
+    const uint64_t start = glfwGetTimerValue();
+
+    for (unsigned long i = 0;  i < count;  i++)
+        integer_sink = glfwGetTimeNs();
+
+    return (double) (glfwGetTimerValue() - start) / glfwGetTimerFrequency();
+}
+
+static double measure_get_timer_value(unsigned long count)
+{
+    const uint64_t start = glfwGetTimerValue();
+
+    for (unsigned long i = 0;  i < count;  i++)
+        integer_sink = glfwGetTimerValue();
+
+    return (double) (glfwGetTimerValue() - start) / glfwGetTimerFrequency();
+}
+
+int main(int argc, char** argv)
+{
+    int ch;
+    unsigned long count = 10000000;
+
+    const struct
+    {
+        int source;
+        const char* name;
+    } sources[] =
+    {
+        { GLFW_TIMER_SOURCE_DEFAULT, "default" },
+        { GLFW_TIMER_SOURCE_MONOTONIC_RAW, "monotonic raw" },
+        { GLFW_TIMER_SOURCE_TSC, "TSC" }
+    };
+
+    while ((ch = getopt(argc, argv, "hn:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                count = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!count)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    printf("Measuring %lu calls per function\n", count);
+
+    for (size_t i = 0;  i < sizeof(sources) / sizeof(sources[0]);  i++)
+    {
+        glfwInitHint(GLFW_TIMER_SOURCE, sources[i].source);
+
+        if (!glfwInit())
+            exit(EXIT_FAILURE);
+
+        printf("Timer source %s (frequency %llu Hz)\n",
+               sources[i].name,
+               (unsigned long long) glfwGetTimerFrequency());
+
+        const double seconds[] =
+        {
+            measure_get_time(count),
+            measure_get_time_ns(count),
+            measure_get_timer_value(count)
+        };
+
+        printf("  glfwGetTime:       %7.2f ns per call\n", seconds[0] * 1e9 / count);
+        printf("  glfwGetTimeNs:     %7.2f ns per call\n", seconds[1] * 1e9 / count);
+        printf("  glfwGetTimerValue: %7.2f ns per call\n", seconds[2] * 1e9 / count);
+
+        glfwTerminate();
+    }
+
+    exit(EXIT_SUCCESS);
+}
+